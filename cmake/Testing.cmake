@@ -56,6 +56,19 @@ function(openassetio_add_test_target target_name)
     set_tests_properties(${target_name} PROPERTIES LABELS Test)
 endfunction()
 
+# Create a CTest benchmark target from a CMake build target.
+#
+# Reuses the target name for the test name.
+#
+# Adds the "Benchmark" label (rather than "Test") so that benchmarks
+# can be run in isolation, or excluded from a regular test run, e.g.
+#   ctest -L Benchmark
+#   ctest -LE Benchmark
+function(openassetio_add_benchmark_target target_name)
+    openassetio_add_generic_test_target(${target_name})
+    set_tests_properties(${target_name} PROPERTIES LABELS Benchmark)
+endfunction()
+
 # Create a generic CTest test target from a CMake build target.
 #
 # Reuses the target name for the test name.
@@ -129,6 +142,21 @@ openassetio_add_test_fixture_target(openassetio.internal.install)
 # installed
 set(OPENASSETIO_TEST_CPP_PLUGINS_SUBDIR ${CMAKE_INSTALL_LIBDIR}/${PROJECT_NAME}/plugins)
 
+if (OPENASSETIO_ENABLE_BENCHMARKS)
+    # Subdirectory under INSTALL_PREFIX where synthetic C++ benchmark
+    # plugins will be installed.
+    set(OPENASSETIO_BENCHMARK_CPP_PLUGINS_SUBDIR
+        ${CMAKE_INSTALL_LIBDIR}/${PROJECT_NAME}/benchmarkPlugins)
+
+    # Number of synthetic manager plugins (of each of C++ and Python)
+    # to generate for plugin system benchmarks, and the number of
+    # search path directories to distribute them across.
+    set(OPENASSETIO_BENCHMARK_PLUGIN_COUNT 32 CACHE STRING
+        "Number of synthetic manager plugins to generate for benchmarks")
+    set(OPENASSETIO_BENCHMARK_PLUGIN_PATH_COUNT 4 CACHE STRING
+        "Number of search path directories to distribute benchmark plugins across")
+endif ()
+
 
 #-----------------------------------------------------------------------
 # Python-specific helpers
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(FederatedManagerInterface)
+
+/**
+ * A @ref managerApi.ManagerInterface "ManagerInterface" that federates
+ * several independent child managers behind a single interface, such
+ * that a host can work with entity references from multiple asset
+ * management systems through a single @ref Manager.
+ *
+ * Batch API calls are partitioned by entity reference, with each
+ * reference routed to the first child (in the order provided to @ref
+ * make) that claims it. Claiming uses the child's advertised @ref
+ * constants.kInfoKey_EntityReferencesMatchPrefix, if available,
+ * otherwise falls back to calling the child's
+ * @ref managerApi.ManagerInterface.isEntityReferenceString
+ * "isEntityReferenceString".
+ *
+ * Where a batch spans multiple children, the sub-batches are dispatched
+ * concurrently, so that the latency of a mixed batch is bounded by the
+ * slowest child rather than the sum of all children. The smallest
+ * sub-batch is processed on the calling thread, and the others on a
+ * pool of worker threads that is shared and re-used across calls.
+ * Callback indices are mapped back to the element's position in the
+ * original batch. Callbacks are serialised, so the host's callbacks
+ * are never invoked concurrently, but may be invoked from a thread
+ * other than the calling thread.
+ *
+ * Entity references that no child claims result in a @ref
+ * errors.BatchElementError.ErrorCode.kInvalidEntityReference
+ * "kInvalidEntityReference" error for that element.
+ *
+ * If any child throws, the remaining sub-batches are still allowed to
+ * complete, and then the exception from the earliest child is
+ * re-thrown.
+ *
+ * API calls that do not take entity references are dispatched to the
+ * first child that advertises the associated capability, as with the
+ * @ref pluginSystem.HybridPluginSystemManagerImplementationFactory
+ * "HybridPluginSystemManagerImplementationFactory".
+ *
+ * Settings are namespaced by child identifier. That is, @ref settings
+ * returns each child's settings with keys of the form
+ * `<childIdentifier>/<key>`, and @ref initialize forwards such keys to
+ * the matching child with the namespace stripped. Keys without a
+ * recognised namespace are forwarded to all children.
+ *
+ * @ref Context "Context" manager state is composed from the state of
+ * each child that supports @ref
+ * managerApi.ManagerInterface.Capability.kStatefulContexts
+ * "kStatefulContexts", and each child is only given its own state.
+ */
+class OPENASSETIO_CORE_EXPORT FederatedManagerInterface final
+    : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(FederatedManagerInterface)
+
+  using ManagerInterfaces = std::vector<managerApi::ManagerInterfacePtr>;
+
+  /// Separator between child identifier and key in settings.
+  static constexpr char kSettingsNamespaceSeparator = '/';
+
+  /**
+   * Construct a new instance.
+   *
+   * @param identifier Identifier to report for the federation.
+   *
+   * @param managerInterfaces Child interfaces to federate, in priority
+   * order. These will be initialized when the federation is
+   * initialized.
+   *
+   * @return New instance.
+   *
+   * @throws errors.InputValidationException if no children are
+   * provided, or any child is null.
+   */
+  static FederatedManagerInterfacePtr make(Identifier identifier,
+                                           ManagerInterfaces managerInterfaces);
+
+  /**
+   * Return the identifier provided on construction.
+   */
+  [[nodiscard]] Identifier identifier() const override;
+
+  /**
+   * Return a comma-separated list of the child display names.
+   */
+  [[nodiscard]] Str displayName() const override;
+
+  /**
+   * Merge the results of `info()` from all children, with the first
+   * child taking precedence in case of a conflict.
+   *
+   * The entity reference prefix key is omitted, since children will
+   * generally have different prefixes.
+   */
+  [[nodiscard]] InfoDictionary info() override;
+
+  /**
+   * Merge the settings of all children, namespaced by child identifier.
+   */
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+
+  /**
+   * The federation has a capability if at least one child has it.
+   */
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+
+  /**
+   * Initialize all children, forwarding namespaced settings to the
+   * appropriate child.
+   *
+   * Once complete, entity reference prefixes and capabilities of the
+   * children are cached for routing subsequent API calls.
+   */
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+
+  /**
+   * Flush caches of all children.
+   */
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+
+  /**
+   * Create a composite state, holding a state for each child that
+   * supports stateful contexts.
+   */
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  /**
+   * Concatenate the persistence tokens of all children, each prefixed
+   * by its length.
+   */
+  [[nodiscard]] Str persistenceTokenForState(
+      const managerApi::ManagerStateBasePtr& state,
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr& hostSession) override;
+
+  /**
+   * A string is an entity reference if any child claims it.
+   */
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess,
+                           const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  /// Private constructor. See @ref make.
+  FederatedManagerInterface(Identifier identifier, ManagerInterfaces managerInterfaces);
+
+  /**
+   * Index of the first child that claims the given entity reference
+   * string, if any.
+   */
+  [[nodiscard]] std::optional<std::size_t> childIndexForReference(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) const;
+
+  /// Identifier of the federation.
+  Identifier identifier_;
+  /// Child interfaces, in priority order.
+  ManagerInterfaces managerInterfaces_;
+  /// Entity reference prefix of each child, cached on initialize.
+  std::vector<std::optional<Str>> entityReferencePrefixes_;
+  /// Index of first child supporting each capability, cached on
+  /// initialize.
+  std::unordered_map<Capability, std::size_t> childIndicesByCapability_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -2,6 +2,7 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string_view>
 #include <unordered_map>
@@ -14,6 +15,7 @@
 OPENASSETIO_FWD_DECLARE(hostApi, HostInterface)
 OPENASSETIO_FWD_DECLARE(hostApi, Manager)
 OPENASSETIO_FWD_DECLARE(hostApi, ManagerImplementationFactoryInterface)
+OPENASSETIO_FWD_DECLARE(hostApi, ManagerPool)
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
 
@@ -159,6 +161,29 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    */
   [[nodiscard]] ManagerPtr createManager(const Identifier& identifier) const;
 
+  /**
+   * Create a @fqref{hostApi.ManagerPool} "ManagerPool" of independent
+   * @fqref{hostApi.Manager} "Manager" instances for the @ref manager
+   * associated with the given identifier.
+   *
+   * This is useful for multi-threaded hosts using managers that are
+   * not themselves thread-safe. Each pooled instance is created as if
+   * by @ref createManager, so has its own @ref manager_state and
+   * caches. The pool must be initialized via
+   * @fqref{hostApi.ManagerPool.initialize} "ManagerPool.initialize"
+   * before use.
+   *
+   * @param identifier Unique manager identifier.
+   *
+   * @param size Number of manager instances in the pool.
+   *
+   * @return Newly instantiated manager pool.
+   *
+   * @throws errors.InputValidationException if `size` is zero.
+   */
+  [[nodiscard]] ManagerPoolPtr createManagerPool(const Identifier& identifier,
+                                                 std::size_t size) const;
+
   /**
    * Create a @fqref{hostApi.Manager} "Manager" instance for the @ref
    * manager associated with the given identifier.
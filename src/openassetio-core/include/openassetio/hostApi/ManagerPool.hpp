@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(Context)
+OPENASSETIO_FWD_DECLARE(hostApi, Manager)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+OPENASSETIO_DECLARE_PTR(ManagerPool)
+
+/**
+ * A fixed-size pool of independent @fqref{hostApi.Manager} "Manager"
+ * instances for the same @ref manager, which are leased to calling
+ * threads for exclusive use.
+ *
+ * This allows a multi-threaded @ref host to make concurrent API calls
+ * to manager implementations that are not themselves thread-safe,
+ * without serialising every call behind a single lock.
+ *
+ * Pools should be created via @fqref{hostApi.ManagerFactory.createManagerPool}
+ * "ManagerFactory.createManagerPool", and then initialized with @ref
+ * initialize, which initializes every pooled instance with the same
+ * settings.
+ *
+ * A @ref Lease provides exclusive access to one pooled `Manager` for
+ * its lifetime, and returns it to the pool on destruction.
+ *
+ * @warning A thread must not call @ref acquire, or any other method
+ * that acquires a lease, whilst already holding a lease. If every
+ * manager is leased (always the case for a pool of size one) the call
+ * blocks forever. Use the equivalent methods of the held @ref Lease
+ * instead.
+ *
+ * Contexts
+ * --------
+ *
+ * A @ref manager_state object is generally only meaningful to the
+ * manager instance that created it. So that a @fqref{Context}
+ * "Context" can be used with whichever instance happens to be leased,
+ * contexts should be created via @ref Lease.createContext, @ref
+ * Lease.createChildContext or @ref Lease.contextFromPersistenceToken
+ * (or the equivalent methods of the pool), and then mapped to the
+ * leased instance via @ref Lease.contextFor before use.
+ *
+ * The pool captures the persistence token of each context's state
+ * when the context is created, and uses it to restore an equivalent
+ * state the first time the context is used with each other instance.
+ * Subsequent use with the same instance re-uses the same restored
+ * state. The persistence token of a pooled context is the token of
+ * the state as originally created, regardless of which instances it
+ * has since been used with.
+ *
+ * The pool remembers a context's states for as long as any of them
+ * (original or restored) is still referenced, so a context returned
+ * by @ref Lease.contextFor remains usable after the original context
+ * is destroyed.
+ */
+class OPENASSETIO_CORE_EXPORT ManagerPool final {
+  class Impl;
+
+ public:
+  OPENASSETIO_ALIAS_PTR(ManagerPool)
+
+  /**
+   * Exclusive, scoped access to one of the pool's
+   * @fqref{hostApi.Manager} "Manager" instances.
+   *
+   * The instance is returned to the pool when the lease is destroyed.
+   */
+  class OPENASSETIO_CORE_EXPORT Lease final {
+   public:
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease&& other) noexcept;
+    ~Lease();
+
+    /**
+     * The leased manager.
+     *
+     * The manager must not be used after the lease is destroyed.
+     */
+    [[nodiscard]] const ManagerPtr& manager() const;
+
+    /// Convenience for accessing the leased manager.
+    Manager* operator->() const;
+
+    /**
+     * Get a @fqref{Context} "Context" equivalent to the given
+     * context, suitable for use with the leased manager.
+     *
+     * @param context Context created by the pool.
+     *
+     * @return The same context if it has no manager state, or if its
+     * state was created by the leased manager. Otherwise a context
+     * sharing the same locale, with a manager state restored from the
+     * context's persistence token by the leased manager.
+     *
+     * @throws errors.InputValidationException if the context has a
+     * manager state that was not created via the pool.
+     */
+    [[nodiscard]] ContextPtr contextFor(const ContextPtr& context) const;
+
+    /**
+     * Create a new context using the leased manager, valid for use
+     * with any pooled manager via @ref contextFor.
+     *
+     * @see @fqref{hostApi.Manager.createContext} "Manager.createContext"
+     */
+    [[nodiscard]] ContextPtr createContext() const;
+
+    /**
+     * Create a child of a pooled context using the leased manager,
+     * valid for use with any pooled manager via @ref contextFor.
+     *
+     * @see @fqref{hostApi.Manager.createChildContext}
+     * "Manager.createChildContext"
+     */
+    [[nodiscard]] ContextPtr createChildContext(const ContextPtr& parentContext) const;
+
+    /**
+     * Restore a pooled context from a persistence token using the
+     * leased manager, valid for use with any pooled manager via @ref
+     * contextFor.
+     *
+     * @see @fqref{hostApi.Manager.contextFromPersistenceToken}
+     * "Manager.contextFromPersistenceToken"
+     */
+    [[nodiscard]] ContextPtr contextFromPersistenceToken(const Str& token) const;
+
+   private:
+    friend class ManagerPool;
+    Lease(std::shared_ptr<Impl> pool, std::size_t index);
+
+    std::shared_ptr<Impl> pool_;
+    std::size_t index_;
+  };
+
+  /**
+   * Construct a pool from existing, uninitialized, managers.
+   *
+   * Generally, hosts should use
+   * @fqref{hostApi.ManagerFactory.createManagerPool}
+   * "ManagerFactory.createManagerPool" instead.
+   *
+   * @param managers Manager instances to pool. These must be distinct
+   * instances with the same identifier.
+   *
+   * @return New pool.
+   *
+   * @throws errors.InputValidationException if no managers are given,
+   * any are null or duplicated, or their identifiers differ.
+   */
+  [[nodiscard]] static ManagerPoolPtr make(std::vector<ManagerPtr> managers);
+
+  /// Identifier of the pooled managers.
+  [[nodiscard]] Identifier identifier() const;
+
+  /// Number of managers in the pool.
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * Initialize all pooled managers with the same settings.
+   *
+   * Managers are initialized concurrently. This blocks until all
+   * outstanding leases have been returned, and no managers can be
+   * leased until initialization is complete.
+   *
+   * @warning Must not be called whilst the calling thread holds a
+   * lease, otherwise it will block forever.
+   *
+   * @param managerSettings Settings to pass to each manager.
+   *
+   * @throws If any manager fails to initialize, the exception from the
+   * first such manager is re-thrown once all have completed.
+   */
+  void initialize(const InfoDictionary& managerSettings);
+
+  /**
+   * Lease a manager, blocking until one is available.
+   *
+   * @return Lease of a manager for exclusive use.
+   */
+  [[nodiscard]] Lease acquire();
+
+  /**
+   * Lease a manager, if one is immediately available.
+   *
+   * @return Lease of a manager for exclusive use, or empty if all
+   * managers are currently leased.
+   */
+  [[nodiscard]] std::optional<Lease> tryAcquire();
+
+  /**
+   * Create a new context, valid for use with any pooled manager via
+   * @ref Lease.contextFor.
+   *
+   * Convenience for acquiring a lease and calling @ref
+   * Lease.createContext, so must not be called whilst the calling
+   * thread holds a lease.
+   *
+   * @see @fqref{hostApi.Manager.createContext} "Manager.createContext"
+   */
+  [[nodiscard]] ContextPtr createContext();
+
+  /**
+   * Create a child of a pooled context, valid for use with any pooled
+   * manager via @ref Lease.contextFor.
+   *
+   * Convenience for acquiring a lease and calling @ref
+   * Lease.createChildContext, so must not be called whilst the
+   * calling thread holds a lease.
+   *
+   * @see @fqref{hostApi.Manager.createChildContext}
+   * "Manager.createChildContext"
+   */
+  [[nodiscard]] ContextPtr createChildContext(const ContextPtr& parentContext);
+
+  /**
+   * Get the persistence token of a pooled context.
+   *
+   * This does not require a lease, since the token is captured when
+   * the context is created.
+   *
+   * @see @fqref{hostApi.Manager.persistenceTokenForContext}
+   * "Manager.persistenceTokenForContext"
+   */
+  [[nodiscard]] Str persistenceTokenForContext(const ContextPtr& context);
+
+  /**
+   * Restore a pooled context from a persistence token, valid for use
+   * with any pooled manager via @ref Lease.contextFor.
+   *
+   * Convenience for acquiring a lease and calling @ref
+   * Lease.contextFromPersistenceToken, so must not be called whilst
+   * the calling thread holds a lease.
+   *
+   * @see @fqref{hostApi.Manager.contextFromPersistenceToken}
+   * "Manager.contextFromPersistenceToken"
+   */
+  [[nodiscard]] ContextPtr contextFromPersistenceToken(const Str& token);
+
+ private:
+  explicit ManagerPool(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
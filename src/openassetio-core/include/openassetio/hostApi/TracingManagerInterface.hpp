@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(TracingManagerInterface)
+
+/**
+ * A @ref managerApi.ManagerInterface "ManagerInterface" that wraps
+ * another, logging a trace of API calls made to it.
+ *
+ * This is intended to sit between a @ref Manager and the manager's
+ * implementation, e.g.
+ *
+ * @code{.cpp}
+ * auto manager = Manager::make(
+ *     TracingManagerInterface::make(implementationFactory->instantiate(identifier)),
+ *     hostSession);
+ * @endcode
+ *
+ * Each traced call is logged to the @ref managerApi.HostSession
+ * "HostSession"'s logger at @ref log.LoggerInterface.Severity.kDebugApi
+ * "kDebugApi" severity, with a summary of its arguments (large batches
+ * are truncated), the number of successful and failed elements for
+ * batch calls, and the wall-clock duration of the call. Calls that
+ * throw are logged with the exception message, before re-throwing.
+ *
+ * To keep overhead low enough to leave enabled, calls can be sampled,
+ * see @ref Sampling. If the logger does not output
+ * @ref log.LoggerInterface.Severity.kDebugApi "kDebugApi" messages,
+ * calls are forwarded directly, without timing or formatting.
+ *
+ * Methods that do not take a @ref managerApi.HostSession "HostSession"
+ * (e.g. @ref identifier, @ref info) have no logger available, so are
+ * forwarded without tracing.
+ */
+class OPENASSETIO_CORE_EXPORT TracingManagerInterface final
+    : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(TracingManagerInterface)
+
+  /**
+   * Criteria for selecting which calls are logged.
+   *
+   * A call is logged if it meets either criterion.
+   */
+  struct Sampling {
+    /**
+     * Log every Nth call, counted across all traced methods. One
+     * logs every call, zero disables periodic sampling.
+     */
+    std::size_t everyNthCall = 1;
+    /**
+     * Log any call that takes at least this long, regardless of
+     * @ref everyNthCall.
+     */
+    std::optional<std::chrono::microseconds> slowCallThreshold;
+  };
+
+  /**
+   * Construct a new instance that logs every call.
+   *
+   * @param managerInterface Interface to forward calls to.
+   *
+   * @return New instance.
+   *
+   * @throws errors.InputValidationException if the manager interface
+   * is null.
+   */
+  static TracingManagerInterfacePtr make(managerApi::ManagerInterfacePtr managerInterface);
+
+  /**
+   * Construct a new instance that logs a sample of calls.
+   *
+   * @param managerInterface Interface to forward calls to.
+   *
+   * @param sampling Criteria for selecting which calls are logged.
+   *
+   * @return New instance.
+   *
+   * @throws errors.InputValidationException if the manager interface
+   * is null.
+   */
+  static TracingManagerInterfacePtr make(managerApi::ManagerInterfacePtr managerInterface,
+                                         Sampling sampling);
+
+  /**
+   * Return the wrapped manager interface.
+   */
+  [[nodiscard]] const managerApi::ManagerInterfacePtr& managerInterface() const;
+
+  /**
+   * Return the sampling criteria provided on construction.
+   */
+  [[nodiscard]] const Sampling& sampling() const;
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] Str persistenceTokenForState(
+      const managerApi::ManagerStateBasePtr& state,
+      const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess,
+                           const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  class CallTrace;
+
+  /// Private constructor. See @ref make.
+  TracingManagerInterface(managerApi::ManagerInterfacePtr managerInterface, Sampling sampling);
+
+  /**
+   * Whether the next call should be logged regardless of duration.
+   * Advances the call count.
+   */
+  [[nodiscard]] bool isNextCallSampled();
+
+  /// Wrapped interface.
+  managerApi::ManagerInterfacePtr managerInterface_;
+  /// Criteria for selecting calls to log.
+  Sampling sampling_;
+  /// Number of traced calls so far, for periodic sampling.
+  std::atomic<std::size_t> numCalls_{0};
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
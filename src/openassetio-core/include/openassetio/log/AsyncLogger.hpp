@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(AsyncLogger)
+/**
+ * A wrapper for a logger that relays messages on a background thread,
+ * such that logging does not block the calling thread on I/O.
+ *
+ * Messages are pushed into a bounded, lock-free, queue and delivered
+ * to the @ref upstreamLogger, in order, by a dedicated thread. This
+ * is useful when the upstream logger is slow, e.g. a @ref
+ * ConsoleLogger writing to a terminal, and verbose (e.g. @ref
+ * Severity.kDebugApi "kDebugApi") logging is enabled.
+ *
+ * Messages are only queued if the upstream logger reports their
+ * severity as logged, so filtering (e.g. by wrapping a @ref
+ * SeverityFilter) costs no more than it would synchronously.
+ *
+ * If the queue is full, the @ref OverflowPolicy determines whether the
+ * calling thread blocks until space is available, or the message is
+ * dropped. Dropped messages are counted, and a warning reporting the
+ * count is relayed once space is available.
+ *
+ * All queued messages are delivered before destruction completes, or
+ * on demand via @ref flush.
+ *
+ * The upstream logger's `log` is only ever called from the background
+ * thread, so need not be thread-safe, though its `isSeverityLogged`
+ * may be called from any thread. Exceptions thrown by the upstream
+ * logger are discarded.
+ *
+ * @warning The upstream logger must not log back into this instance,
+ * and must not release the last reference to it.
+ */
+class OPENASSETIO_CORE_EXPORT AsyncLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(AsyncLogger)
+
+  /// Behaviour when logging to a full queue.
+  enum class OverflowPolicy : std::uint8_t {
+    /// Block the calling thread until space is available.
+    kBlock,
+    /// Drop the message, without blocking.
+    kDrop
+  };
+
+  /// Default maximum number of queued messages.
+  static constexpr std::size_t kDefaultCapacity = 8192;
+
+  /**
+   * Creates a new instance of the AsyncLogger, starting its background
+   * thread.
+   *
+   * @param upstreamLogger A logger that will receive messages on the
+   * background thread.
+   *
+   * @param capacity Maximum number of queued messages. Rounded up to
+   * a power of two.
+   *
+   * @param overflowPolicy Behaviour when the queue is full.
+   *
+   * @throws errors.InputValidationException if the upstream logger is
+   * null or the capacity is zero.
+   */
+  [[nodiscard]] static AsyncLoggerPtr make(LoggerInterfacePtr upstreamLogger,
+                                           std::size_t capacity = kDefaultCapacity,
+                                           OverflowPolicy overflowPolicy = OverflowPolicy::kBlock);
+
+  /**
+   * Stops the background thread, after delivering all queued messages.
+   */
+  ~AsyncLogger() override;
+
+  AsyncLogger(const AsyncLogger&) = delete;
+  AsyncLogger(AsyncLogger&&) noexcept = delete;
+  AsyncLogger& operator=(const AsyncLogger&) = delete;
+  AsyncLogger& operator=(AsyncLogger&&) noexcept = delete;
+
+  /**
+   * Returns the logger wrapped by this instance.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Queue a message for delivery to the @ref upstreamLogger.
+   *
+   * @param severity Severity level.
+   *
+   * @param message The message to be logged.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Delegates to the @ref upstreamLogger.
+   *
+   * @param severity Severity level to check.
+   *
+   * @return Whether a log message at the given severity will be output.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+  /**
+   * Block until all messages queued before this call have been
+   * delivered to the @ref upstreamLogger.
+   */
+  void flush();
+
+  /**
+   * Total number of messages dropped due to a full queue.
+   *
+   * Always zero for the @ref OverflowPolicy.kBlock "kBlock" policy.
+   */
+  [[nodiscard]] std::size_t droppedCount() const;
+
+ private:
+  class Impl;
+
+  explicit AsyncLogger(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(BinaryLogger)
+/**
+ * A logger that appends compact binary records to a file, for
+ * high-volume diagnostics.
+ *
+ * Each record holds a timestamp, the index of the logging thread, the
+ * severity and the message. Records are appended to a buffer private
+ * to the calling thread, so threads do not contend with each other,
+ * and a buffer is only written to the file once full, when its thread
+ * exits, or on @ref flush or destruction. Formatting of timestamps and
+ * severities into human-readable text is deferred until the file is
+ * read with @ref decode and @ref formatRecord.
+ *
+ * A full buffer is written synchronously by the thread that filled
+ * it, whilst holding a lock on the file shared by all threads. So the
+ * occasional call to @ref log that fills a buffer blocks for the
+ * duration of a file write, and possibly other threads' writes. The
+ * buffer size trades off the frequency of such calls against memory
+ * use.
+ *
+ * Buffers are released when their thread exits, so memory use does
+ * not grow with the number of threads that have logged over time, and
+ * each thread is given its own index, even if the platform reuses
+ * thread IDs.
+ *
+ * Records are self-delimiting, so a file is readable up to the last
+ * complete record written, e.g. after a crash. Messages still held in
+ * thread buffers at the time of a crash are lost, so call @ref flush
+ * at points of interest where that matters.
+ *
+ * All severities are logged. Wrap in a @ref SeverityFilter to filter.
+ */
+class OPENASSETIO_CORE_EXPORT BinaryLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(BinaryLogger)
+
+  /// A decoded log record.
+  struct Record {
+    /// Time the message was logged, since the system clock epoch.
+    std::chrono::nanoseconds timeSinceEpoch;
+    /// Index of the logging thread, unique to each thread, in order of first use.
+    std::uint32_t threadIndex;
+    /// Severity of the message.
+    Severity severity;
+    /// The logged message.
+    Str message;
+  };
+  using Records = std::vector<Record>;
+
+  /// Default size, in bytes, of each thread's buffer.
+  static constexpr std::size_t kDefaultThreadBufferSize = 64 * 1024;
+
+  /**
+   * Creates a new instance of the BinaryLogger, truncating the file if
+   * it exists.
+   *
+   * @param filePath Path of the file to write.
+   *
+   * @param threadBufferSize Number of bytes to buffer per thread
+   * before writing to the file.
+   *
+   * @throws errors.InputValidationException if the file cannot be
+   * opened for writing.
+   */
+  [[nodiscard]] static BinaryLoggerPtr make(
+      const Str& filePath, std::size_t threadBufferSize = kDefaultThreadBufferSize);
+
+  /**
+   * Writes all buffered records to the file.
+   */
+  ~BinaryLogger() override;
+
+  BinaryLogger(const BinaryLogger&) = delete;
+  BinaryLogger(BinaryLogger&&) noexcept = delete;
+  BinaryLogger& operator=(const BinaryLogger&) = delete;
+  BinaryLogger& operator=(BinaryLogger&&) noexcept = delete;
+
+  /**
+   * Append a record to the calling thread's buffer.
+   *
+   * @param severity Severity level.
+   *
+   * @param message The message to be logged.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Write the buffered records of all threads to the file.
+   */
+  void flush();
+
+  /**
+   * Path of the file being written.
+   */
+  [[nodiscard]] const Str& filePath() const;
+
+  /**
+   * Read the records from a file written by a BinaryLogger.
+   *
+   * Records are returned in timestamp order. A truncated final record
+   * is ignored.
+   *
+   * @param filePath Path of the file to read.
+   *
+   * @return Decoded records.
+   *
+   * @throws errors.InputValidationException if the file cannot be
+   * read or is not a BinaryLogger file.
+   */
+  [[nodiscard]] static Records decode(const Str& filePath);
+
+  /**
+   * Format a decoded record as a line of text, of the form
+   * `<UTC timestamp> [<thread index>] <severity>: <message>`.
+   *
+   * @param record Record to format.
+   *
+   * @return Formatted record.
+   *
+   * @throws errors.InputValidationException if the record's severity
+   * is not a valid @ref Severity.
+   */
+  [[nodiscard]] static Str formatRecord(const Record& record);
+
+ private:
+  class Impl;
+
+  explicit BinaryLogger(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
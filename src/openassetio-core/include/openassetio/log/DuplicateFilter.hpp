@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(DuplicateFilter)
+/**
+ * The DuplicateFilter is a wrapper for a logger that suppresses
+ * repeats of a message, protecting the upstream logger from "log
+ * storms", e.g. the same warning issued for every element of a large
+ * batch.
+ *
+ * The first occurrence of a message is relayed immediately and starts
+ * a time window. Identical messages (same severity and text) logged
+ * within that window are counted rather than relayed. The count is
+ * reported as a single summary message, of the form
+ * `<message> (repeated <count> more times)`, by the first call to
+ * @ref log (of any message) after the window has elapsed, once a
+ * different message displaces it, or on @ref flush or destruction.
+ * Summaries are therefore only relayed whilst messages are being
+ * logged, so hosts that may stop logging for long periods should call
+ * @ref flush periodically if summaries must not be delayed.
+ *
+ * Messages are tracked in a small fixed-size table, keyed by a hash of
+ * their severity and text, so only recent messages are detected as
+ * duplicates. Messages that are not duplicates are relayed without
+ * taking any locks.
+ *
+ * This class is safe to use concurrently from multiple threads.
+ * Summary counts are exact, though a message racing with the message
+ * that displaces it may occasionally be relayed rather than counted.
+ */
+class OPENASSETIO_CORE_EXPORT DuplicateFilter final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(DuplicateFilter)
+
+  /// Default period within which repeated messages are suppressed.
+  static constexpr std::chrono::milliseconds kDefaultWindow{1000};
+
+  /**
+   * Creates a new instance of the DuplicateFilter.
+   *
+   * @param upstreamLogger A logger that will receive the first of any
+   * repeated messages, and summaries of those suppressed.
+   *
+   * @param window Period, from the first occurrence of a message,
+   * within which repeats of it are suppressed.
+   *
+   * @throws errors.InputValidationException if the upstream logger is
+   * null or the window is not positive.
+   */
+  [[nodiscard]] static DuplicateFilterPtr make(LoggerInterfacePtr upstreamLogger,
+                                               std::chrono::milliseconds window = kDefaultWindow);
+
+  /**
+   * Relays summaries of any suppressed messages.
+   */
+  ~DuplicateFilter() override;
+
+  DuplicateFilter(const DuplicateFilter&) = delete;
+  DuplicateFilter(DuplicateFilter&&) noexcept = delete;
+  DuplicateFilter& operator=(const DuplicateFilter&) = delete;
+  DuplicateFilter& operator=(DuplicateFilter&&) noexcept = delete;
+
+  /**
+   * Returns the logger wrapped by the filter.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Returns the period within which repeated messages are suppressed.
+   */
+  [[nodiscard]] std::chrono::milliseconds window() const;
+
+  /**
+   * Relay the message to the @ref upstreamLogger, unless it repeats a
+   * recent message.
+   *
+   * @param severity Severity level.
+   *
+   * @param message The message to be logged.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Defers to the @ref upstreamLogger.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+  /**
+   * Relay summaries of all currently suppressed messages to the @ref
+   * upstreamLogger.
+   */
+  void flush();
+
+ private:
+  class Impl;
+
+  explicit DuplicateFilter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
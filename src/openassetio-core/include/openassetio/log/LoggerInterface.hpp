@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <array>
+#include <type_traits>
+#include <utility>
 
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
@@ -44,6 +46,12 @@ class OPENASSETIO_CORE_EXPORT LoggerInterface {
                                              "warning",  "error", "critical"};
   /// @}
 
+ private:
+  /// Constrain lazy overloads, so they don't capture string arguments.
+  template <typename MessageFn>
+  using EnableIfMessageFn = std::enable_if_t<std::is_invocable_r_v<Str, MessageFn&&>>;
+
+ public:
   /// Defaulted polymorphic destructor.
   virtual ~LoggerInterface();
 
@@ -102,6 +110,72 @@ class OPENASSETIO_CORE_EXPORT LoggerInterface {
   void error(const Str& message);
   void critical(const Str& message);
 
+  /**
+   * @}
+   */
+
+  /**
+   * Logs a message constructed on demand, only if the severity will be
+   * output.
+   *
+   * The callable is only invoked if @ref isSeverityLogged returns
+   * `true` for the given severity, such that the cost of constructing
+   * the message (e.g. formatting) is avoided for filtered severities.
+   *
+   * @code{.cpp}
+   * logger->logLazily(Severity::kDebug, [&] { return fmt::format("Loaded '{}'", path); });
+   * @endcode
+   *
+   * @param severity One of the severity constants defined in @ref
+   * Severity.
+   *
+   * @param messageFn Callable taking no arguments and returning the
+   * message string to be logged.
+   */
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void logLazily(const Severity severity, MessageFn&& messageFn) {
+    if (isSeverityLogged(severity)) {
+      log(severity, std::forward<MessageFn>(messageFn)());
+    }
+  }
+
+  /**
+   * @name Lazy conveniences
+   * @{
+   *
+   * Conveniences, equivalent to calling @ref logLazily with the
+   * corresponding @ref Severity.
+   */
+
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void debugApi(MessageFn&& messageFn) {
+    logLazily(Severity::kDebugApi, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void debug(MessageFn&& messageFn) {
+    logLazily(Severity::kDebug, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void info(MessageFn&& messageFn) {
+    logLazily(Severity::kInfo, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void progress(MessageFn&& messageFn) {
+    logLazily(Severity::kProgress, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void warning(MessageFn&& messageFn) {
+    logLazily(Severity::kWarning, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void error(MessageFn&& messageFn) {
+    logLazily(Severity::kError, std::forward<MessageFn>(messageFn));
+  }
+  template <typename MessageFn, typename = EnableIfMessageFn<MessageFn>>
+  void critical(MessageFn&& messageFn) {
+    logLazily(Severity::kCritical, std::forward<MessageFn>(messageFn));
+  }
+
   /**
    * @}
    */
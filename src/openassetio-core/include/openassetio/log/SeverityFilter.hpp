@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2025 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 #include <openassetio/export.h>
 #include <openassetio/log/LoggerInterface.hpp>
@@ -13,10 +18,20 @@ OPENASSETIO_DECLARE_PTR(SeverityFilter)
  * The SeverityFilter is a wrapper for a logger that drops messages
  * below a requested severity. More severe messages are relayed.
  *
+ * Separate thresholds can be configured for named sources (e.g. a
+ * subsystem or a particular manager), by logging through a @ref
+ * sourceLogger. This allows verbose logging to be enabled for one
+ * source without enabling it, and paying its formatting costs,
+ * everywhere.
+ *
+ * Thresholds may be read and modified concurrently from any thread.
+ *
  * @envvar **OPENASSETIO_LOGGING_SEVERITY** *[int]* If set, the default
  * displaySeverity for the filter is set to the value of the env var.
  */
-class OPENASSETIO_CORE_EXPORT SeverityFilter final : public LoggerInterface {
+class OPENASSETIO_CORE_EXPORT SeverityFilter final
+    : public LoggerInterface,
+      public std::enable_shared_from_this<SeverityFilter> {
  public:
   OPENASSETIO_ALIAS_PTR(SeverityFilter)
 
@@ -80,6 +95,58 @@ class OPENASSETIO_CORE_EXPORT SeverityFilter final : public LoggerInterface {
    * @}
    */
 
+  /**
+   * @name Source Severity
+   * Thresholds for messages logged via a @ref sourceLogger.
+   * @{
+   */
+
+  /**
+   * Returns a logger that relays messages from the named source to the
+   * @ref upstreamLogger, filtered by the source's severity threshold.
+   *
+   * If no threshold has been set for the source, the filter's own
+   * severity (see @ref getSeverity) is used. Thresholds set after the
+   * logger is created are respected.
+   *
+   * @param source Arbitrary name for the source of messages.
+   *
+   * @return Logger for the source. Repeated calls with the same source
+   * return the same instance.
+   */
+  [[nodiscard]] LoggerInterfacePtr sourceLogger(const Str& source);
+
+  /**
+   * Sets the minimum severity of message from the named source that
+   * will be passed on to the @ref upstreamLogger, overriding the
+   * filter's own severity.
+   *
+   * @param source Name of the source.
+   *
+   * @param severity The minimum severity.
+   */
+  void setSourceSeverity(const Str& source, LoggerInterface::Severity severity);
+
+  /**
+   * Returns the minimum severity for the named source, if one has been
+   * set.
+   *
+   * @param source Name of the source.
+   */
+  [[nodiscard]] std::optional<LoggerInterface::Severity> getSourceSeverity(
+      const Str& source) const;
+
+  /**
+   * Removes any severity set for the named source, such that the
+   * filter's own severity is used.
+   *
+   * @param source Name of the source.
+   */
+  void resetSourceSeverity(const Str& source);
+  /**
+   * @}
+   */
+
   /**
    * Filter out messages based on severity before delegating to the
    * @ref upstreamLogger.
@@ -94,10 +161,20 @@ class OPENASSETIO_CORE_EXPORT SeverityFilter final : public LoggerInterface {
   void log(Severity severity, const Str& message) override;
 
  private:
+  class SourceLogger;
+  struct SourceState;
+
   explicit SeverityFilter(LoggerInterfacePtr upstreamLogger);
 
-  Severity minSeverity_ = Severity::kWarning;
+  /// Get or create the state for a source. Requires sourcesMutex_.
+  const std::shared_ptr<SourceState>& sourceState(const Str& source);
+
+  std::atomic<Severity> minSeverity_{Severity::kWarning};
   LoggerInterfacePtr upstreamLogger_;
+
+  /// Guards sources_, but not the thresholds within.
+  mutable std::mutex sourcesMutex_;
+  std::unordered_map<Str, std::shared_ptr<SourceState>> sources_;
 };
 }  // namespace log
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -825,6 +825,12 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
    *
    * @see @fqref{errors.BatchElementError.ErrorCode} "ErrorCode" for
    * appropriate error codes.
+   *
+   * In Python, this and the success callbacks of batch methods
+   * additionally provide a `many(indices, values)` method, to report
+   * the results for many elements in a single call. This avoids the
+   * overhead of a call from Python to C++ for each element, which is
+   * significant for large batches.
    */
   using BatchElementErrorCallback = std::function<void(std::size_t, errors::BatchElementError)>;
   /**
@@ -34,6 +34,16 @@ OPENASSETIO_DECLARE_PTR(HybridPluginSystemManagerImplementationFactory)
  * If multiple plugins support the same capability, then priority is
  * given to the plugin corresponding to the earliest in the list of
  * provided child factories.
+ *
+ * By default, @ref managerApi.ManagerInterface.initialize "initialize"
+ * and @ref managerApi.ManagerInterface.flushCaches "flushCaches" are
+ * called on each child in priority order. Optionally, these can
+ * instead be called on all children concurrently, such that the cost
+ * of, e.g., each child connecting to a back-end service is not paid
+ * back to back. In this case, child implementations must be tolerant
+ * of their siblings being initialized at the same time. If more than
+ * one child fails, the exception from the highest priority child is
+ * re-thrown, and the others are logged.
  */
 class OPENASSETIO_CORE_EXPORT HybridPluginSystemManagerImplementationFactory
     : public hostApi::ManagerImplementationFactoryInterface {
@@ -50,10 +60,15 @@ class OPENASSETIO_CORE_EXPORT HybridPluginSystemManagerImplementationFactory
    *
    * @param logger Logger for progress and warnings.
    *
+   * @param concurrentLifecycle Whether to initialize and flush the
+   * caches of composed child implementations concurrently, rather than
+   * in priority order.
+   *
    * @return New instance.
    */
   static HybridPluginSystemManagerImplementationFactoryPtr make(
-      ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger);
+      ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger,
+      bool concurrentLifecycle = false);
 
   /**
    * Get a list of all manager plugin identifiers known to all child
@@ -89,11 +104,14 @@ class OPENASSETIO_CORE_EXPORT HybridPluginSystemManagerImplementationFactory
 
  private:
   /// Private constructor. See @ref make.
-  explicit HybridPluginSystemManagerImplementationFactory(
-      ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger);
+  HybridPluginSystemManagerImplementationFactory(ManagerImplementationFactoryInterfaces factories,
+                                                 log::LoggerInterfacePtr logger,
+                                                 bool concurrentLifecycle);
 
   /// Child factories to compose.
   ManagerImplementationFactoryInterfaces factories_;
+  /// Whether to initialize/flush composed children concurrently.
+  bool concurrentLifecycle_;
 };
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2024 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
@@ -34,6 +36,16 @@ enum class PathType : std::uint8_t {
  * (internally, multiple regex patterns are compiled). Once constructed,
  * an instance can be used to process any number of URLs/paths.
  *
+ * Instances are thread-safe, i.e. a single instance can be shared by
+ * multiple threads and used concurrently, without locking.
+ *
+ * Conversions avoid allocating where possible. Internal regex match
+ * buffers are pooled per-thread and shared by all conversions made on
+ * that thread, single or batch, rather than allocated per conversion.
+ * The batch overloads write each result into the existing element of
+ * the output vector, re-using its capacity, so re-using the same
+ * output vector across batches avoids allocating a string per element.
+ *
  * Conversion of Windows UNC paths to file URLs is supported, including
  * `\\?\` device paths. However, conversion of file URLs back to Windows
  * paths only supports drive paths or standard UNC share paths, not
@@ -51,8 +63,41 @@ enum class PathType : std::uint8_t {
  */
 class OPENASSETIO_CORE_EXPORT FileUrlPathConverter {
  public:
+  /**
+   * Usage of a converter's cache of conversion results.
+   *
+   * @see @ref FileUrlPathConverter(std::size_t)
+   */
+  struct CacheStatistics {
+    /// Number of conversions served from the cache.
+    std::size_t hits;
+    /// Number of conversions that had to be computed.
+    std::size_t misses;
+    /// Number of conversions currently cached.
+    std::size_t size;
+    /// Maximum number of conversions that can be cached.
+    std::size_t capacity;
+  };
+
   /// Constructor.
   FileUrlPathConverter();
+
+  /**
+   * Construct a converter that caches conversion results.
+   *
+   * Hosts and managers often convert the same paths and URLs
+   * repeatedly. Results of successful conversions are cached, keyed on
+   * the input string and @ref PathType, such that repeated conversions
+   * skip validation and encoding entirely, and just copy the cached
+   * result. Invalid inputs are not cached.
+   *
+   * Once full, less recently used entries are evicted. The cache is
+   * thread-safe, consistent with the rest of this class.
+   *
+   * @param cacheCapacity Maximum number of cached conversions, shared
+   * by both directions of conversion. Zero disables caching.
+   */
+  explicit FileUrlPathConverter(std::size_t cacheCapacity);
   /// Defaulted destructor.
   ~FileUrlPathConverter();
 
@@ -112,6 +157,56 @@ class OPENASSETIO_CORE_EXPORT FileUrlPathConverter {
   [[nodiscard]] Str pathFromUrl(std::string_view fileUrl,
                                 PathType pathType = PathType::kSystem) const;
 
+  /**
+   * Construct file URLs from a batch of paths.
+   *
+   * Equivalent to calling @ref pathToUrl(std::string_view, PathType)
+   * const "pathToUrl" for each path, except that each URL is written
+   * into the existing element of @p fileUrls, re-using its capacity.
+   *
+   * @param absolutePaths Path strings.
+   *
+   * @param[out] fileUrls Converted file URLs, resized to match
+   * @p absolutePaths. Existing elements are overwritten in place,
+   * retaining their capacity.
+   *
+   * @param pathType Platform associated with paths.
+   *
+   * @throws InputValidationException if any path is invalid or
+   * unsupported. The contents of @p fileUrls are then unspecified.
+   */
+  void pathToUrl(const std::vector<std::string_view> &absolutePaths, std::vector<Str> &fileUrls,
+                 PathType pathType = PathType::kSystem) const;
+
+  /**
+   * Construct paths from a batch of file URLs.
+   *
+   * Equivalent to calling @ref pathFromUrl(std::string_view, PathType)
+   * const "pathFromUrl" for each URL, except that each path is written
+   * into the existing element of @p paths, re-using its capacity.
+   *
+   * @param fileUrls URLs to convert.
+   *
+   * @param[out] paths Extracted paths, resized to match @p fileUrls.
+   * Existing elements are overwritten in place, retaining their
+   * capacity.
+   *
+   * @param pathType Platform associated with paths.
+   *
+   * @throws InputValidationException if any URL or path that it
+   * decodes to is invalid or unsupported. The contents of @p paths are
+   * then unspecified.
+   */
+  void pathFromUrl(const std::vector<std::string_view> &fileUrls, std::vector<Str> &paths,
+                   PathType pathType = PathType::kSystem) const;
+
+  /**
+   * Get hit/miss counts and current occupancy of the cache.
+   *
+   * @return Cache statistics, all zero if caching is disabled.
+   */
+  [[nodiscard]] CacheStatistics cacheStatistics() const;
+
  private:
   std::unique_ptr<struct FileUrlPathConverterImpl> impl_;
 };
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstdint>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 
@@ -45,6 +47,111 @@ namespace utils {
  */
 OPENASSETIO_CORE_EXPORT openassetio::Str substitute(
     std::string_view input, const openassetio::InfoDictionary& substitutions);
+
+/**
+ * Pre-parsed string template for repeated substitution.
+ *
+ * Equivalent to @ref substitute, but the template is parsed once on
+ * construction, rather than on every call. This is useful when the
+ * same template is rendered against many dictionaries, e.g. when
+ * generating per-frame or per-version paths.
+ *
+ * Placeholders must be named, i.e. of the form `{key}` or
+ * `{key:spec}`. Positional placeholders (`{}`, `{0}`) and nested
+ * placeholders within a format specifier are not supported.
+ *
+ * Instances are immutable, so can be shared between threads.
+ */
+class OPENASSETIO_CORE_EXPORT CompiledSubstitution {
+ public:
+  /**
+   * Construct by parsing a template string.
+   *
+   * @param input The string in which substitutions are to be made. See
+   * @ref substitute.
+   *
+   * @throws errors.InputValidationException if the template is
+   * malformed or uses unsupported placeholders.
+   */
+  explicit CompiledSubstitution(std::string_view input);
+
+  /// The template string.
+  [[nodiscard]] const Str& input() const { return input_; }
+
+  /**
+   * Keys referenced by placeholders in the template.
+   *
+   * Each key is listed once, in order of first appearance.
+   */
+  [[nodiscard]] const std::vector<Str>& keys() const { return keys_; }
+
+  /**
+   * Substitute placeholders using the provided dictionary.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @return The template with all substitutions made.
+   *
+   * @throws errors.InputValidationException if a substitution variable
+   * is not found in the dictionary, or its value is incompatible with
+   * the format specifier.
+   */
+  [[nodiscard]] Str render(const InfoDictionary& substitutions) const;
+
+  /**
+   * Substitute placeholders using the provided dictionary, writing to
+   * an existing string.
+   *
+   * The string's contents are replaced, but its capacity is re-used,
+   * so a string can be re-used across calls to avoid allocation.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @param[out] result The template with all substitutions made.
+   *
+   * @throws errors.InputValidationException as for
+   * @ref render(const InfoDictionary&) const "render". The contents of
+   * @p result are then unspecified.
+   */
+  void render(const InfoDictionary& substitutions, Str& result) const;
+
+  /**
+   * Substitute placeholders using each of a batch of dictionaries.
+   *
+   * @param substitutionsBatch Dictionaries to render against.
+   *
+   * @param[out] results Rendered strings, resized to match
+   * @p substitutionsBatch. Existing elements are overwritten, re-using
+   * their capacity, so a vector can be re-used across batches.
+   *
+   * @throws errors.InputValidationException as for
+   * @ref render(const InfoDictionary&) const "render", if rendering
+   * any element fails. The contents of @p results are then
+   * unspecified.
+   */
+  void render(const std::vector<InfoDictionary>& substitutionsBatch,
+              std::vector<Str>& results) const;
+
+ private:
+  /// Part of the template: either literal text or a placeholder.
+  struct Segment {
+    enum class Kind : std::uint8_t { kLiteral, kPlaceholder };
+    Kind kind;
+    /// Literal text, or placeholder key.
+    Str text;
+    /// Format string for the placeholder value (i.e. `{:spec}`), or
+    /// empty if there is no format specifier.
+    Str valueFormat;
+  };
+
+  void renderTo(const InfoDictionary& substitutions, Str& result) const;
+
+  Str input_;
+  std::vector<Segment> segments_;
+  std::vector<Str> keys_;
+};
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,620 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/FederatedManagerInterface.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../utils/concurrency.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/**
+ * Composite manager state, holding the state of each child in the same
+ * order as the children. Children that do not support stateful
+ * contexts have a null state.
+ */
+struct FederatedManagerState final : managerApi::ManagerStateBase {
+  explicit FederatedManagerState(std::vector<managerApi::ManagerStateBasePtr> states)
+      : childStates{std::move(states)} {}
+
+  std::vector<managerApi::ManagerStateBasePtr> childStates;
+};
+
+/// Marker used in persistence tokens for a child with no state.
+constexpr char kNullStateToken = '-';
+/// Separator between length and token in persistence tokens.
+constexpr char kTokenLengthSeparator = ':';
+
+/**
+ * The subset of a batch that is routed to a single child.
+ */
+struct Partition {
+  /// Entity references routed to the child.
+  EntityReferences entityReferences;
+  /// Index of each entity reference in the original batch.
+  std::vector<std::size_t> indices;
+};
+
+const FederatedManagerState& federatedStateFrom(const managerApi::ManagerStateBasePtr& state) {
+  const auto* federatedState = dynamic_cast<const FederatedManagerState*>(state.get());
+  if (!federatedState) {
+    throw errors::InputValidationException{
+        "FederatedManager: Manager state was not created by this manager"};
+  }
+  return *federatedState;
+}
+
+/**
+ * Get a Context suitable for passing to a child, i.e. with the child's
+ * portion of any composite manager state.
+ */
+ContextConstPtr contextForChild(const ContextConstPtr& context, const std::size_t childIdx) {
+  if (!context || !context->managerState) {
+    return context;
+  }
+  return Context::make(context->locale,
+                       federatedStateFrom(context->managerState).childStates[childIdx]);
+}
+
+/**
+ * Gather elements of a parallel input array corresponding to the
+ * entity references in a partition.
+ */
+template <class Elements>
+Elements gather(const Elements& elements, const std::vector<std::size_t>& indices) {
+  Elements result;
+  result.reserve(indices.size());
+  for (const std::size_t idx : indices) {
+    result.push_back(elements[idx]);
+  }
+  return result;
+}
+
+/**
+ * Wrap a callback such that the index provided by a child is mapped
+ * back to the index in the original batch, and such that calls are
+ * serialised with other children's callbacks.
+ */
+template <class Callback>
+auto remapped(const Callback& callback, const std::vector<std::size_t>& indices,
+              std::mutex& callbackMutex) {
+  return [&callback, &indices, &callbackMutex](const std::size_t idx, auto value) {
+    const std::lock_guard lock{callbackMutex};
+    callback(indices[idx], std::move(value));
+  };
+}
+
+/**
+ * Call `work(childIdx, partition)` for each non-empty partition,
+ * concurrently.
+ *
+ * The smallest partition is processed on the calling thread, which is
+ * then free to process any other partition that a worker thread has
+ * not yet started.
+ *
+ * If any work throws, the exception corresponding to the earliest
+ * child is re-thrown, once all work is complete.
+ */
+template <class Work>
+void dispatchConcurrently(const std::vector<Partition>& partitions, const Work& work) {
+  std::vector<std::size_t> childIdxs;
+  std::size_t smallestIdx = 0;
+  for (std::size_t childIdx = 0; childIdx < partitions.size(); ++childIdx) {
+    const std::size_t size = partitions[childIdx].indices.size();
+    if (size == 0) {
+      continue;
+    }
+    if (!childIdxs.empty() && size < partitions[childIdxs[smallestIdx]].indices.size()) {
+      smallestIdx = childIdxs.size();
+    }
+    childIdxs.push_back(childIdx);
+  }
+
+  utils::rethrowFirst(utils::invokeConcurrently(
+      childIdxs.size(),
+      [&](const std::size_t idx) { work(childIdxs[idx], partitions[childIdxs[idx]]); },
+      smallestIdx));
+}
+
+errors::BatchElementError unroutableReferenceError(const EntityReference& entityReference) {
+  return errors::BatchElementError{
+      errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+      fmt::format("Entity reference '{}' is not recognised by any federated manager",
+                  entityReference.toString())};
+}
+
+/**
+ * Partition a batch of entity references by the index of the child
+ * returned by `router`, reporting an error for any entity reference
+ * that no child claims.
+ */
+template <class Router>
+std::vector<Partition> partitionByChild(
+    const std::size_t numChildren, const EntityReferences& entityReferences, const Router& router,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  std::vector<Partition> partitions(numChildren);
+  for (std::size_t elementIdx = 0; elementIdx < entityReferences.size(); ++elementIdx) {
+    const EntityReference& entityReference = entityReferences[elementIdx];
+    if (const auto childIdx = router(entityReference.toString())) {
+      partitions[*childIdx].entityReferences.push_back(entityReference);
+      partitions[*childIdx].indices.push_back(elementIdx);
+    } else {
+      errorCallback(elementIdx, unroutableReferenceError(entityReference));
+    }
+  }
+  return partitions;
+}
+}  // namespace
+
+FederatedManagerInterfacePtr FederatedManagerInterface::make(Identifier identifier,
+                                                             ManagerInterfaces managerInterfaces) {
+  if (managerInterfaces.empty()) {
+    throw errors::InputValidationException{
+        "FederatedManager: At least one child manager interface must be provided"};
+  }
+  if (std::any_of(cbegin(managerInterfaces), cend(managerInterfaces),
+                  [](const auto& managerInterface) { return !managerInterface; })) {
+    throw errors::InputValidationException{
+        "FederatedManager: Child manager interface cannot be null"};
+  }
+
+  return std::shared_ptr<FederatedManagerInterface>(
+      new FederatedManagerInterface(std::move(identifier), std::move(managerInterfaces)));
+}
+
+FederatedManagerInterface::FederatedManagerInterface(Identifier identifier,
+                                                     ManagerInterfaces managerInterfaces)
+    : identifier_{std::move(identifier)},
+      managerInterfaces_{std::move(managerInterfaces)},
+      entityReferencePrefixes_(managerInterfaces_.size()) {}
+
+Identifier FederatedManagerInterface::identifier() const { return identifier_; }
+
+Str FederatedManagerInterface::displayName() const {
+  std::vector<Str> displayNames;
+  displayNames.reserve(managerInterfaces_.size());
+  for (const auto& managerInterface : managerInterfaces_) {
+    displayNames.push_back(managerInterface->displayName());
+  }
+  return fmt::format("{}", fmt::join(displayNames, ", "));
+}
+
+InfoDictionary FederatedManagerInterface::info() {
+  InfoDictionary result;
+  for (const auto& managerInterface : managerInterfaces_) {
+    result.merge(managerInterface->info());
+  }
+  result.erase(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
+  return result;
+}
+
+InfoDictionary FederatedManagerInterface::settings(const managerApi::HostSessionPtr& hostSession) {
+  InfoDictionary result;
+  for (const auto& managerInterface : managerInterfaces_) {
+    const Identifier childIdentifier = managerInterface->identifier();
+    for (auto& [key, value] : managerInterface->settings(hostSession)) {
+      result.try_emplace(fmt::format("{}{}{}", childIdentifier, kSettingsNamespaceSeparator, key),
+                         std::move(value));
+    }
+  }
+  return result;
+}
+
+bool FederatedManagerInterface::hasCapability(const Capability capability) {
+  return childIndicesByCapability_.count(capability) > 0;
+}
+
+void FederatedManagerInterface::initialize(const InfoDictionary managerSettings,
+                                           const managerApi::HostSessionPtr& hostSession) {
+  Identifiers childIdentifiers;
+  childIdentifiers.reserve(managerInterfaces_.size());
+  for (const auto& managerInterface : managerInterfaces_) {
+    childIdentifiers.push_back(managerInterface->identifier());
+  }
+
+  // Distribute settings to children, stripping the namespace from
+  // namespaced keys.
+  std::vector<InfoDictionary> childSettings(managerInterfaces_.size());
+  for (const auto& [key, value] : managerSettings) {
+    bool isNamespaced = false;
+    if (const auto separatorPos = key.find(kSettingsNamespaceSeparator);
+        separatorPos != Str::npos) {
+      const auto keyNamespace = key.substr(0, separatorPos);
+      for (std::size_t childIdx = 0; childIdx < childIdentifiers.size(); ++childIdx) {
+        if (childIdentifiers[childIdx] == keyNamespace) {
+          childSettings[childIdx][key.substr(separatorPos + 1)] = value;
+          isNamespaced = true;
+        }
+      }
+    }
+    if (!isNamespaced) {
+      for (auto& settings : childSettings) {
+        settings.try_emplace(key, value);
+      }
+    }
+  }
+
+  for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+    managerInterfaces_[childIdx]->initialize(std::move(childSettings[childIdx]), hostSession);
+  }
+
+  // Cache each child's entity reference prefix, if any, to avoid
+  // calling isEntityReferenceString on the child for every element
+  // of every batch.
+  for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+    const InfoDictionary childInfo = managerInterfaces_[childIdx]->info();
+    entityReferencePrefixes_[childIdx].reset();
+    if (const auto iter = childInfo.find(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
+        iter != childInfo.end()) {
+      if (const auto* prefix = std::get_if<Str>(&iter->second)) {
+        entityReferencePrefixes_[childIdx] = *prefix;
+      }
+    }
+  }
+
+  // Cache the first child that supports each capability. See
+  // HybridManagerInterface for rationale.
+  childIndicesByCapability_.clear();
+  for (std::size_t capabilityIdx = 0; capabilityIdx < kCapabilityNames.size(); ++capabilityIdx) {
+    const auto capability = static_cast<Capability>(capabilityIdx);
+    for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+      if (managerInterfaces_[childIdx]->hasCapability(capability)) {
+        childIndicesByCapability_[capability] = childIdx;
+        break;
+      }
+    }
+  }
+}
+
+void FederatedManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  for (const auto& managerInterface : managerInterfaces_) {
+    managerInterface->flushCaches(hostSession);
+  }
+}
+
+std::optional<std::size_t> FederatedManagerInterface::childIndexForReference(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) const {
+  for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+    if (const auto& prefix = entityReferencePrefixes_[childIdx]) {
+      if (someString.rfind(*prefix, 0) != Str::npos) {
+        return childIdx;
+      }
+    } else if (managerInterfaces_[childIdx]->isEntityReferenceString(someString, hostSession)) {
+      return childIdx;
+    }
+  }
+  return std::nullopt;
+}
+
+StrMap FederatedManagerInterface::updateTerminology(
+    StrMap terms, const managerApi::HostSessionPtr& hostSession) {
+  if (const auto& capabilityAndChildIdx =
+          childIndicesByCapability_.find(Capability::kCustomTerminology);
+      capabilityAndChildIdx != cend(childIndicesByCapability_)) {
+    return managerInterfaces_[capabilityAndChildIdx->second]->updateTerminology(std::move(terms),
+                                                                               hostSession);
+  }
+  return ManagerInterface::updateTerminology(std::move(terms), hostSession);
+}
+
+trait::TraitsDatas FederatedManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  if (const auto& capabilityAndChildIdx =
+          childIndicesByCapability_.find(Capability::kManagementPolicyQueries);
+      capabilityAndChildIdx != cend(childIndicesByCapability_)) {
+    const std::size_t childIdx = capabilityAndChildIdx->second;
+    return managerInterfaces_[childIdx]->managementPolicy(
+        traitSets, policyAccess, contextForChild(context, childIdx), hostSession);
+  }
+  return ManagerInterface::managementPolicy(traitSets, policyAccess, context, hostSession);
+}
+
+managerApi::ManagerStateBasePtr FederatedManagerInterface::createState(
+    const managerApi::HostSessionPtr& hostSession) {
+  std::vector<managerApi::ManagerStateBasePtr> childStates;
+  childStates.reserve(managerInterfaces_.size());
+  for (const auto& managerInterface : managerInterfaces_) {
+    childStates.push_back(managerInterface->hasCapability(Capability::kStatefulContexts)
+                              ? managerInterface->createState(hostSession)
+                              : nullptr);
+  }
+  return std::make_shared<FederatedManagerState>(std::move(childStates));
+}
+
+managerApi::ManagerStateBasePtr FederatedManagerInterface::createChildState(
+    const managerApi::ManagerStateBasePtr& parentState,
+    const managerApi::HostSessionPtr& hostSession) {
+  const FederatedManagerState& federatedParentState = federatedStateFrom(parentState);
+
+  std::vector<managerApi::ManagerStateBasePtr> childStates;
+  childStates.reserve(managerInterfaces_.size());
+  for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+    const auto& childParentState = federatedParentState.childStates[childIdx];
+    childStates.push_back(
+        childParentState
+            ? managerInterfaces_[childIdx]->createChildState(childParentState, hostSession)
+            : nullptr);
+  }
+  return std::make_shared<FederatedManagerState>(std::move(childStates));
+}
+
+Str FederatedManagerInterface::persistenceTokenForState(
+    const managerApi::ManagerStateBasePtr& state, const managerApi::HostSessionPtr& hostSession) {
+  const FederatedManagerState& federatedState = federatedStateFrom(state);
+
+  Str token;
+  for (std::size_t childIdx = 0; childIdx < managerInterfaces_.size(); ++childIdx) {
+    const auto& childState = federatedState.childStates[childIdx];
+    if (!childState) {
+      token += kNullStateToken;
+      continue;
+    }
+    const Str childToken =
+        managerInterfaces_[childIdx]->persistenceTokenForState(childState, hostSession);
+    token += fmt::format("{}{}{}", childToken.size(), kTokenLengthSeparator, childToken);
+  }
+  return token;
+}
+
+managerApi::ManagerStateBasePtr FederatedManagerInterface::stateFromPersistenceToken(
+    const Str& token, const managerApi::HostSessionPtr& hostSession) {
+  const auto malformedToken = [&token] {
+    return errors::InputValidationException{
+        fmt::format("FederatedManager: Malformed persistence token '{}'", token)};
+  };
+
+  std::vector<managerApi::ManagerStateBasePtr> childStates;
+  childStates.reserve(managerInterfaces_.size());
+
+  std::size_t pos = 0;
+  for (const auto& managerInterface : managerInterfaces_) {
+    if (pos < token.size() && token[pos] == kNullStateToken) {
+      childStates.emplace_back();
+      ++pos;
+      continue;
+    }
+
+    const std::size_t separatorPos = token.find(kTokenLengthSeparator, pos);
+    if (separatorPos == Str::npos || separatorPos == pos) {
+      throw malformedToken();
+    }
+    std::size_t childTokenSize = 0;
+    const char* const lengthEnd = token.data() + separatorPos;
+    const auto [lengthParseEnd, lengthParseError] =
+        std::from_chars(token.data() + pos, lengthEnd, childTokenSize);
+    if (lengthParseError != std::errc{} || lengthParseEnd != lengthEnd) {
+      throw malformedToken();
+    }
+    pos = separatorPos + 1;
+    if (childTokenSize > token.size() - pos) {
+      throw malformedToken();
+    }
+
+    childStates.push_back(managerInterface->stateFromPersistenceToken(
+        token.substr(pos, childTokenSize), hostSession));
+    pos += childTokenSize;
+  }
+
+  if (pos != token.size()) {
+    throw malformedToken();
+  }
+
+  return std::make_shared<FederatedManagerState>(std::move(childStates));
+}
+
+bool FederatedManagerInterface::isEntityReferenceString(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) {
+  return childIndexForReference(someString, hostSession).has_value();
+}
+
+void FederatedManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const ExistsSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->entityExists(
+        partition.entityReferences, contextForChild(context, childIdx), hostSession,
+        remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+
+void FederatedManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                             const access::EntityTraitsAccess entityTraitsAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const EntityTraitsSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->entityTraits(
+        partition.entityReferences, entityTraitsAccess, contextForChild(context, childIdx),
+        hostSession, remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+
+void FederatedManagerInterface::resolve(const EntityReferences& entityReferences,
+                                        const trait::TraitSet& traitSet,
+                                        const access::ResolveAccess resolveAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const ResolveSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->resolve(
+        partition.entityReferences, traitSet, resolveAccess, contextForChild(context, childIdx),
+        hostSession, remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+
+void FederatedManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (const auto& capabilityAndChildIdx =
+          childIndicesByCapability_.find(Capability::kDefaultEntityReferences);
+      capabilityAndChildIdx != cend(childIndicesByCapability_)) {
+    const std::size_t childIdx = capabilityAndChildIdx->second;
+    managerInterfaces_[childIdx]->defaultEntityReference(
+        traitSets, defaultEntityAccess, contextForChild(context, childIdx), hostSession,
+        successCallback, errorCallback);
+    return;
+  }
+  ManagerInterface::defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                           successCallback, errorCallback);
+}
+
+void FederatedManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->getWithRelationship(
+        partition.entityReferences, relationshipTraitsData, resultTraitSet, pageSize,
+        relationsAccess, contextForChild(context, childIdx), hostSession,
+        remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+
+void FederatedManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  // Batch is over relationships, not entity references, so there is
+  // nothing to partition.
+  const auto childIdx = childIndexForReference(entityReference.toString(), hostSession);
+  if (!childIdx) {
+    for (std::size_t elementIdx = 0; elementIdx < relationshipTraitsDatas.size(); ++elementIdx) {
+      errorCallback(elementIdx, unroutableReferenceError(entityReference));
+    }
+    return;
+  }
+  managerInterfaces_[*childIdx]->getWithRelationships(
+      entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+      contextForChild(context, *childIdx), hostSession, successCallback, errorCallback);
+}
+
+void FederatedManagerInterface::preflight(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& traitsHints,
+                                          const access::PublishingAccess publishingAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const PreflightSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  if (traitsHints.size() != entityReferences.size()) {
+    throw errors::InputValidationException{fmt::format(
+        "FederatedManager: Parameter lists must be of the same length: {} entity references vs."
+        " {} traits hints.",
+        entityReferences.size(), traitsHints.size())};
+  }
+
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->preflight(
+        partition.entityReferences, gather(traitsHints, partition.indices), publishingAccess,
+        contextForChild(context, childIdx), hostSession,
+        remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+
+void FederatedManagerInterface::register_(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& entityTraitsDatas,
+                                          const access::PublishingAccess publishingAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const RegisterSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  if (entityTraitsDatas.size() != entityReferences.size()) {
+    throw errors::InputValidationException{fmt::format(
+        "FederatedManager: Parameter lists must be of the same length: {} entity references vs."
+        " {} traits datas.",
+        entityReferences.size(), entityTraitsDatas.size())};
+  }
+
+  const std::vector<Partition> partitions = partitionByChild(
+      managerInterfaces_.size(), entityReferences,
+      [&](const Str& someString) { return childIndexForReference(someString, hostSession); },
+      errorCallback);
+  std::mutex callbackMutex;
+
+  dispatchConcurrently(partitions, [&](const std::size_t childIdx, const Partition& partition) {
+    managerInterfaces_[childIdx]->register_(
+        partition.entityReferences, gather(entityTraitsDatas, partition.indices),
+        publishingAccess, contextForChild(context, childIdx), hostSession,
+        remapped(successCallback, partition.indices, callbackMutex),
+        remapped(errorCallback, partition.indices, callbackMutex));
+  });
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
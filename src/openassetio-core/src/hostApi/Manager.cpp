@@ -78,11 +78,13 @@ std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &
   if (const auto iter = info.find(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
       iter != info.end()) {
     if (const auto *prefixPtr = std::get_if<Str>(&iter->second)) {
-      logger->debugApi(
-          fmt::format("Entity reference prefix '{}' provided by manager's info() dict. Subsequent"
-                      " calls to isEntityReferenceString will use this prefix rather than call the"
-                      " manager's implementation.",
-                      *prefixPtr));
+      logger->debugApi([&] {
+        return fmt::format(
+            "Entity reference prefix '{}' provided by manager's info() dict. Subsequent calls to"
+            " isEntityReferenceString will use this prefix rather than call the manager's"
+            " implementation.",
+            *prefixPtr);
+      });
 
       return *prefixPtr;
     }
@@ -2,14 +2,18 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #include <openassetio/hostApi/ManagerFactory.hpp>
 
+#include <cstddef>
 #include <cstdlib>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/hostApi/ManagerPool.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
@@ -52,6 +56,19 @@ ManagerPtr ManagerFactory::createManager(const Identifier& identifier) const {
                                    logger_);
 }
 
+ManagerPoolPtr ManagerFactory::createManagerPool(const Identifier& identifier,
+                                                 const std::size_t size) const {
+  if (size == 0) {
+    throw errors::InputValidationException{"ManagerPool: Size must be greater than zero"};
+  }
+  std::vector<ManagerPtr> managers;
+  managers.reserve(size);
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    managers.push_back(createManager(identifier));
+  }
+  return ManagerPool::make(std::move(managers));
+}
+
 ManagerPtr ManagerFactory::createManagerForInterface(
     const Identifier& identifier, const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
@@ -0,0 +1,372 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/ManagerPool.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../utils/concurrency.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+/**
+ * Shared implementation, kept alive by both the pool and any
+ * outstanding leases.
+ */
+class ManagerPool::Impl {
+  /**
+   * Book-keeping for the manager state of a context created via the
+   * pool.
+   */
+  struct PooledState {
+    /// State as originally created.
+    std::weak_ptr<managerApi::ManagerStateBase> origin;
+    /// Index of the manager that created the original state.
+    std::size_t originIndex;
+    /// Persistence token of the original state.
+    Str token;
+    /// Equivalent state for each manager, restored from the token on
+    /// first use with that manager.
+    std::vector<managerApi::ManagerStateBasePtr> restoredStates;
+
+    /**
+     * Whether no context references any of the states any more.
+     *
+     * Restored states are only referenced elsewhere if their use count
+     * exceeds the one held here. Since only the registry can hand out
+     * new references to a restored state, and it does so under the
+     * registry lock, this cannot change whilst the lock is held.
+     */
+    [[nodiscard]] bool isExpired() const {
+      return origin.expired() &&
+             std::all_of(restoredStates.begin(), restoredStates.end(),
+                         [](const managerApi::ManagerStateBasePtr& state) {
+                           return !state || state.use_count() == 1;
+                         });
+    }
+  };
+  using PooledStatePtr = std::shared_ptr<PooledState>;
+
+  /// Minimum registry size at which expired entries are purged.
+  static constexpr std::size_t kMinPurgeThreshold = 64;
+
+ public:
+  explicit Impl(std::vector<ManagerPtr> managers) : managers_{std::move(managers)} {
+    // Lease lower indices first, so a lightly loaded pool tends to
+    // re-use the same few instances, keeping their caches warm.
+    freeIndices_.reserve(managers_.size());
+    for (std::size_t idx = managers_.size(); idx > 0; --idx) {
+      freeIndices_.push_back(idx - 1);
+    }
+  }
+
+  [[nodiscard]] const std::vector<ManagerPtr>& managers() const { return managers_; }
+
+  std::size_t acquireIndex() {
+    std::unique_lock lock{mutex_};
+    available_.wait(lock, [this] { return !freeIndices_.empty(); });
+    const std::size_t index = freeIndices_.back();
+    freeIndices_.pop_back();
+    return index;
+  }
+
+  std::optional<std::size_t> tryAcquireIndex() {
+    const std::lock_guard lock{mutex_};
+    if (freeIndices_.empty()) {
+      return std::nullopt;
+    }
+    const std::size_t index = freeIndices_.back();
+    freeIndices_.pop_back();
+    return index;
+  }
+
+  void release(const std::size_t index) {
+    {
+      const std::lock_guard lock{mutex_};
+      freeIndices_.push_back(index);
+    }
+    available_.notify_one();
+  }
+
+  void initialize(const InfoDictionary& managerSettings) {
+    std::vector<std::size_t> indices;
+    {
+      std::unique_lock lock{mutex_};
+      available_.wait(lock, [this] { return freeIndices_.size() == managers_.size(); });
+      indices.swap(freeIndices_);
+    }
+
+    const auto exceptions =
+        utils::invokeConcurrently(managers_.size(), [&](const std::size_t idx) {
+          managers_[idx]->initialize(managerSettings);
+        });
+
+    {
+      const std::lock_guard lock{mutex_};
+      freeIndices_.swap(indices);
+    }
+    available_.notify_all();
+
+    utils::rethrowFirst(exceptions);
+  }
+
+  /**
+   * Record the state of a newly created context, such that it can
+   * later be mapped to other managers.
+   *
+   * Must only be called whilst holding the lease for `index`.
+   */
+  ContextPtr registerContext(ContextPtr context, const std::size_t index,
+                             std::optional<Str> token = std::nullopt) {
+    if (!context->managerState) {
+      return context;
+    }
+    if (!token) {
+      token = managers_[index]->persistenceTokenForContext(context);
+    }
+
+    auto pooledState = std::make_shared<PooledState>(
+        PooledState{context->managerState, index, std::move(*token),
+                    std::vector<managerApi::ManagerStateBasePtr>(managers_.size())});
+
+    const std::lock_guard lock{registryMutex_};
+    insertState(context->managerState.get(), std::move(pooledState));
+    return context;
+  }
+
+  /**
+   * Map a pooled context to one valid for the manager at `index`.
+   *
+   * Must only be called whilst holding the lease for `index`.
+   */
+  ContextPtr contextFor(const ContextPtr& context, const std::size_t index) {
+    if (!context->managerState) {
+      return context;
+    }
+
+    const PooledStatePtr pooledState = findPooledState(context->managerState);
+
+    managerApi::ManagerStateBasePtr state;
+    {
+      const std::lock_guard lock{registryMutex_};
+      if (index == pooledState->originIndex) {
+        state = pooledState->origin.lock();
+      }
+      if (!state) {
+        state = pooledState->restoredStates[index];
+      }
+    }
+
+    if (state == context->managerState) {
+      return context;
+    }
+
+    if (!state) {
+      // Safe to call outside of the registry lock, since only the
+      // holder of the lease for `index` can restore its state.
+      state = managers_[index]->contextFromPersistenceToken(pooledState->token)->managerState;
+      if (state) {
+        const std::lock_guard lock{registryMutex_};
+        pooledState->restoredStates[index] = state;
+        insertState(state.get(), pooledState);
+      }
+    }
+
+    return Context::make(context->locale, std::move(state));
+  }
+
+  Str persistenceTokenForContext(const ContextPtr& context) {
+    if (!context->managerState) {
+      return "";
+    }
+    return findPooledState(context->managerState)->token;
+  }
+
+ private:
+  PooledStatePtr findPooledState(const managerApi::ManagerStateBasePtr& state) {
+    const std::lock_guard lock{registryMutex_};
+    if (const auto iter = pooledStates_.find(state.get()); iter != pooledStates_.end()) {
+      const PooledStatePtr& pooledState = iter->second;
+      // Guard against the address of an expired original state being
+      // re-used by an unrelated state.
+      if (pooledState->origin.lock() == state ||
+          std::find(pooledState->restoredStates.begin(), pooledState->restoredStates.end(),
+                    state) != pooledState->restoredStates.end()) {
+        return pooledState;
+      }
+    }
+    throw errors::InputValidationException{
+        "ManagerPool: Context has a manager state that was not created via this pool"};
+  }
+
+  /**
+   * Add a registry entry, purging expired entries if the registry has
+   * grown enough since the last purge, such that the cost of purging
+   * is amortised over insertions.
+   *
+   * Must be called whilst holding registryMutex_.
+   */
+  void insertState(const managerApi::ManagerStateBase* key, PooledStatePtr pooledState) {
+    pooledStates_[key] = std::move(pooledState);
+    if (pooledStates_.size() >= purgeThreshold_) {
+      removeExpiredStates();
+      purgeThreshold_ = std::max(kMinPurgeThreshold, 2 * pooledStates_.size());
+    }
+  }
+
+  /// Must be called whilst holding registryMutex_.
+  void removeExpiredStates() {
+    std::unordered_set<const PooledState*> expired;
+    for (const auto& [key, pooledState] : pooledStates_) {
+      if (pooledState->isExpired()) {
+        expired.insert(pooledState.get());
+      }
+    }
+    if (expired.empty()) {
+      return;
+    }
+    for (auto iter = pooledStates_.begin(); iter != pooledStates_.end();) {
+      if (expired.count(iter->second.get()) > 0) {
+        iter = pooledStates_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  std::vector<ManagerPtr> managers_;
+
+  std::mutex mutex_;
+  std::condition_variable available_;
+  std::vector<std::size_t> freeIndices_;
+
+  std::mutex registryMutex_;
+  /// Pooled state keyed by both original and restored states.
+  std::unordered_map<const managerApi::ManagerStateBase*, PooledStatePtr> pooledStates_;
+  /// Registry size at which to next purge expired entries.
+  std::size_t purgeThreshold_{kMinPurgeThreshold};
+};
+
+ManagerPool::Lease::Lease(std::shared_ptr<Impl> pool, const std::size_t index)
+    : pool_{std::move(pool)}, index_{index} {}
+
+ManagerPool::Lease::Lease(Lease&& other) noexcept
+    : pool_{std::move(other.pool_)}, index_{other.index_} {}
+
+ManagerPool::Lease& ManagerPool::Lease::operator=(Lease&& other) noexcept {
+  if (this != &other) {
+    if (pool_) {
+      pool_->release(index_);
+    }
+    pool_ = std::move(other.pool_);
+    index_ = other.index_;
+  }
+  return *this;
+}
+
+ManagerPool::Lease::~Lease() {
+  if (pool_) {
+    pool_->release(index_);
+  }
+}
+
+const ManagerPtr& ManagerPool::Lease::manager() const { return pool_->managers()[index_]; }
+
+Manager* ManagerPool::Lease::operator->() const { return manager().get(); }
+
+ContextPtr ManagerPool::Lease::contextFor(const ContextPtr& context) const {
+  return pool_->contextFor(context, index_);
+}
+
+ContextPtr ManagerPool::Lease::createContext() const {
+  return pool_->registerContext(manager()->createContext(), index_);
+}
+
+ContextPtr ManagerPool::Lease::createChildContext(const ContextPtr& parentContext) const {
+  return pool_->registerContext(manager()->createChildContext(contextFor(parentContext)),
+                                index_);
+}
+
+ContextPtr ManagerPool::Lease::contextFromPersistenceToken(const Str& token) const {
+  return pool_->registerContext(manager()->contextFromPersistenceToken(token), index_, token);
+}
+
+ManagerPoolPtr ManagerPool::make(std::vector<ManagerPtr> managers) {
+  if (managers.empty()) {
+    throw errors::InputValidationException{"ManagerPool: At least one manager must be provided"};
+  }
+  if (std::any_of(cbegin(managers), cend(managers),
+                  [](const ManagerPtr& manager) { return !manager; })) {
+    throw errors::InputValidationException{"ManagerPool: Manager cannot be null"};
+  }
+  if (std::unordered_set<ManagerPtr>(cbegin(managers), cend(managers)).size() !=
+      managers.size()) {
+    throw errors::InputValidationException{"ManagerPool: Managers must be distinct instances"};
+  }
+  const Identifier identifier = managers.front()->identifier();
+  for (const ManagerPtr& manager : managers) {
+    if (manager->identifier() != identifier) {
+      throw errors::InputValidationException{
+          fmt::format("ManagerPool: Managers must have the same identifier: '{}' vs. '{}'",
+                      identifier, manager->identifier())};
+    }
+  }
+
+  return ManagerPoolPtr{new ManagerPool{std::make_shared<Impl>(std::move(managers))}};
+}
+
+ManagerPool::ManagerPool(std::shared_ptr<Impl> impl) : impl_{std::move(impl)} {}
+
+Identifier ManagerPool::identifier() const { return impl_->managers().front()->identifier(); }
+
+std::size_t ManagerPool::size() const { return impl_->managers().size(); }
+
+void ManagerPool::initialize(const InfoDictionary& managerSettings) {
+  impl_->initialize(managerSettings);
+}
+
+ManagerPool::Lease ManagerPool::acquire() { return Lease{impl_, impl_->acquireIndex()}; }
+
+std::optional<ManagerPool::Lease> ManagerPool::tryAcquire() {
+  if (const auto index = impl_->tryAcquireIndex()) {
+    return Lease{impl_, *index};
+  }
+  return std::nullopt;
+}
+
+ContextPtr ManagerPool::createContext() { return acquire().createContext(); }
+
+ContextPtr ManagerPool::createChildContext(const ContextPtr& parentContext) {
+  return acquire().createChildContext(parentContext);
+}
+
+Str ManagerPool::persistenceTokenForContext(const ContextPtr& context) {
+  return impl_->persistenceTokenForContext(context);
+}
+
+ContextPtr ManagerPool::contextFromPersistenceToken(const Str& token) {
+  return acquire().contextFromPersistenceToken(token);
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
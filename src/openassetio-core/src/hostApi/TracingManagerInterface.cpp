@@ -0,0 +1,513 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/TracingManagerInterface.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+/// Maximum number of elements of a batch to include in a trace.
+constexpr std::size_t kMaxSummarisedElements = 3;
+
+/**
+ * Summarise a collection as a delimited list of its first few
+ * elements, followed by the number of elements omitted, if any.
+ */
+template <class Elements, class FormatElement>
+Str summarise(const Elements& elements, const std::string_view open, const std::string_view close,
+              const FormatElement& formatElement) {
+  fmt::memory_buffer buffer;
+  buffer.append(open);
+  std::size_t idx = 0;
+  for (const auto& element : elements) {
+    if (idx == kMaxSummarisedElements) {
+      fmt::format_to(std::back_inserter(buffer), ", ... {} more",
+                     elements.size() - kMaxSummarisedElements);
+      break;
+    }
+    if (idx != 0) {
+      buffer.append(std::string_view{", "});
+    }
+    formatElement(buffer, element);
+    ++idx;
+  }
+  buffer.append(close);
+  return fmt::to_string(buffer);
+}
+
+Str summarise(const EntityReferences& entityReferences) {
+  return summarise(entityReferences, "[", "]", [](auto& buffer, const auto& entityReference) {
+    fmt::format_to(std::back_inserter(buffer), "'{}'", entityReference.toString());
+  });
+}
+
+Str summarise(const trait::TraitSet& traitSet) {
+  return summarise(traitSet, "{", "}", [](auto& buffer, const auto& traitId) {
+    fmt::format_to(std::back_inserter(buffer), "'{}'", traitId);
+  });
+}
+
+Str summarise(const trait::TraitSets& traitSets) {
+  return summarise(traitSets, "[", "]", [](auto& buffer, const auto& traitSet) {
+    buffer.append(summarise(traitSet));
+  });
+}
+
+Str summarise(const trait::TraitsDatas& traitsDatas) {
+  return summarise(traitsDatas, "[", "]", [](auto& buffer, const auto& traitsData) {
+    buffer.append(traitsData ? summarise(traitsData->traitSet()) : Str{"None"});
+  });
+}
+
+template <class Access>
+std::string_view accessName(const Access access) {
+  return access::kAccessNames[static_cast<std::size_t>(access)];
+}
+
+/// Describe the exception currently being handled.
+Str describeCurrentException() {
+  try {
+    throw;
+  } catch (const std::exception& exc) {
+    return fmt::format("threw '{}'", exc.what());
+  } catch (...) {
+    return "threw a non-exception";
+  }
+}
+
+/**
+ * Call `call()`, logging a trace via `trace` if active.
+ *
+ * The trace message is constructed from `describeArgs()` and, on
+ * success, `describeOutcome()`, only if it is to be logged.
+ */
+template <class Trace, class DescribeArgs, class Call, class DescribeOutcome>
+auto traced(const Trace& trace, const std::string_view method, const DescribeArgs& describeArgs,
+            const Call& call, const DescribeOutcome& describeOutcome) {
+  if (!trace.isActive()) {
+    return call();
+  }
+  if constexpr (std::is_void_v<std::invoke_result_t<Call>>) {
+    try {
+      call();
+    } catch (...) {
+      trace.log(method, describeArgs, describeCurrentException);
+      throw;
+    }
+    trace.log(method, describeArgs, describeOutcome);
+  } else {
+    auto result = [&] {
+      try {
+        return call();
+      } catch (...) {
+        trace.log(method, describeArgs, describeCurrentException);
+        throw;
+      }
+    }();
+    trace.log(method, describeArgs, describeOutcome);
+    return result;
+  }
+}
+
+template <class Trace, class DescribeArgs, class Call>
+auto traced(const Trace& trace, const std::string_view method, const DescribeArgs& describeArgs,
+            const Call& call) {
+  return traced(trace, method, describeArgs, call, [] { return Str{"completed"}; });
+}
+
+/**
+ * Call `call(successCallback, errorCallback)`, logging a trace via
+ * `trace` if active, including the number of successful and failed
+ * elements.
+ */
+template <class Trace, class DescribeArgs, class SuccessCallback, class Call>
+void tracedBatch(const Trace& trace, const std::string_view method,
+                 const DescribeArgs& describeArgs, const SuccessCallback& successCallback,
+                 const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback,
+                 const Call& call) {
+  if (!trace.isActive()) {
+    call(successCallback, errorCallback);
+    return;
+  }
+  // Managers may call back from multiple threads.
+  std::atomic<std::size_t> numSucceeded{0};
+  std::atomic<std::size_t> numFailed{0};
+
+  const SuccessCallback countingSuccessCallback{
+      [&](const std::size_t idx, auto value) {
+        numSucceeded.fetch_add(1, std::memory_order_relaxed);
+        successCallback(idx, std::move(value));
+      }};
+  const managerApi::ManagerInterface::BatchElementErrorCallback countingErrorCallback{
+      [&](const std::size_t idx, errors::BatchElementError error) {
+        numFailed.fetch_add(1, std::memory_order_relaxed);
+        errorCallback(idx, std::move(error));
+      }};
+
+  traced(
+      trace, method, describeArgs, [&] { call(countingSuccessCallback, countingErrorCallback); },
+      [&] {
+        return fmt::format("{} succeeded, {} failed", numSucceeded.load(), numFailed.load());
+      });
+}
+}  // namespace
+
+/**
+ * Tracing state of a single API call.
+ */
+class TracingManagerInterface::CallTrace {
+ public:
+  CallTrace(TracingManagerInterface& tracer, const managerApi::HostSessionPtr& hostSession)
+      : tracer_{tracer}, logger_{*hostSession->logger()} {
+    if (!logger_.isSeverityLogged(log::LoggerInterface::Severity::kDebugApi)) {
+      return;
+    }
+    isSampled_ = tracer_.isNextCallSampled();
+    isActive_ = isSampled_ || tracer_.sampling_.slowCallThreshold.has_value();
+    start_ = Clock::now();
+  }
+
+  /// Whether the call needs timing, i.e. may be logged.
+  [[nodiscard]] bool isActive() const { return isActive_; }
+
+  /// Log the call, if it was sampled or was slow.
+  template <class DescribeArgs, class DescribeOutcome>
+  void log(const std::string_view method, const DescribeArgs& describeArgs,
+           const DescribeOutcome& describeOutcome) const {
+    const auto duration = Clock::now() - start_;
+    if (!isSampled_ && duration < *tracer_.sampling_.slowCallThreshold) {
+      return;
+    }
+    // Severity already checked on construction.
+    logger_.log(log::LoggerInterface::Severity::kDebugApi,
+                fmt::format("{}.{}({}) -> {} in {:.3f} ms",
+                            tracer_.managerInterface_->identifier(), method, describeArgs(),
+                            describeOutcome(),
+                            std::chrono::duration<double, std::milli>{duration}.count()));
+  }
+
+ private:
+  TracingManagerInterface& tracer_;
+  log::LoggerInterface& logger_;
+  bool isActive_{false};
+  bool isSampled_{false};
+  Clock::time_point start_;
+};
+
+TracingManagerInterfacePtr TracingManagerInterface::make(
+    managerApi::ManagerInterfacePtr managerInterface) {
+  return make(std::move(managerInterface), Sampling{});
+}
+
+TracingManagerInterfacePtr TracingManagerInterface::make(
+    managerApi::ManagerInterfacePtr managerInterface, Sampling sampling) {
+  if (!managerInterface) {
+    throw errors::InputValidationException{
+        "TracingManagerInterface: Manager interface cannot be null"};
+  }
+  return std::shared_ptr<TracingManagerInterface>(
+      new TracingManagerInterface(std::move(managerInterface), std::move(sampling)));
+}
+
+TracingManagerInterface::TracingManagerInterface(managerApi::ManagerInterfacePtr managerInterface,
+                                                 Sampling sampling)
+    : managerInterface_{std::move(managerInterface)}, sampling_{std::move(sampling)} {}
+
+const managerApi::ManagerInterfacePtr& TracingManagerInterface::managerInterface() const {
+  return managerInterface_;
+}
+
+const TracingManagerInterface::Sampling& TracingManagerInterface::sampling() const {
+  return sampling_;
+}
+
+bool TracingManagerInterface::isNextCallSampled() {
+  if (sampling_.everyNthCall == 0) {
+    return false;
+  }
+  if (sampling_.everyNthCall == 1) {
+    return true;
+  }
+  return numCalls_.fetch_add(1, std::memory_order_relaxed) % sampling_.everyNthCall == 0;
+}
+
+Identifier TracingManagerInterface::identifier() const { return managerInterface_->identifier(); }
+
+Str TracingManagerInterface::displayName() const { return managerInterface_->displayName(); }
+
+InfoDictionary TracingManagerInterface::info() { return managerInterface_->info(); }
+
+bool TracingManagerInterface::hasCapability(const Capability capability) {
+  return managerInterface_->hasCapability(capability);
+}
+
+InfoDictionary TracingManagerInterface::settings(const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "settings", [] { return Str{}; },
+      [&] { return managerInterface_->settings(hostSession); });
+}
+
+void TracingManagerInterface::initialize(InfoDictionary managerSettings,
+                                         const managerApi::HostSessionPtr& hostSession) {
+  const std::size_t numSettings = managerSettings.size();
+  traced(
+      CallTrace{*this, hostSession}, "initialize",
+      [&] { return fmt::format("managerSettings={} keys", numSettings); },
+      [&] { managerInterface_->initialize(std::move(managerSettings), hostSession); });
+}
+
+void TracingManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  traced(
+      CallTrace{*this, hostSession}, "flushCaches", [] { return Str{}; },
+      [&] { managerInterface_->flushCaches(hostSession); });
+}
+
+StrMap TracingManagerInterface::updateTerminology(StrMap terms,
+                                                  const managerApi::HostSessionPtr& hostSession) {
+  const std::size_t numTerms = terms.size();
+  return traced(
+      CallTrace{*this, hostSession}, "updateTerminology",
+      [&] { return fmt::format("terms={} terms", numTerms); },
+      [&] { return managerInterface_->updateTerminology(std::move(terms), hostSession); });
+}
+
+trait::TraitsDatas TracingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "managementPolicy",
+      [&] {
+        return fmt::format("traitSets={}, policyAccess={}", summarise(traitSets),
+                           accessName(policyAccess));
+      },
+      [&] {
+        return managerInterface_->managementPolicy(traitSets, policyAccess, context, hostSession);
+      });
+}
+
+managerApi::ManagerStateBasePtr TracingManagerInterface::createState(
+    const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "createState", [] { return Str{}; },
+      [&] { return managerInterface_->createState(hostSession); });
+}
+
+managerApi::ManagerStateBasePtr TracingManagerInterface::createChildState(
+    const managerApi::ManagerStateBasePtr& parentState,
+    const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "createChildState", [] { return Str{}; },
+      [&] { return managerInterface_->createChildState(parentState, hostSession); });
+}
+
+Str TracingManagerInterface::persistenceTokenForState(
+    const managerApi::ManagerStateBasePtr& state, const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "persistenceTokenForState", [] { return Str{}; },
+      [&] { return managerInterface_->persistenceTokenForState(state, hostSession); });
+}
+
+managerApi::ManagerStateBasePtr TracingManagerInterface::stateFromPersistenceToken(
+    const Str& token, const managerApi::HostSessionPtr& hostSession) {
+  return traced(
+      CallTrace{*this, hostSession}, "stateFromPersistenceToken",
+      [&] { return fmt::format("token='{}'", token); },
+      [&] { return managerInterface_->stateFromPersistenceToken(token, hostSession); });
+}
+
+bool TracingManagerInterface::isEntityReferenceString(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) {
+  bool result = false;
+  traced(
+      CallTrace{*this, hostSession}, "isEntityReferenceString",
+      [&] { return fmt::format("someString='{}'", someString); },
+      [&] { result = managerInterface_->isEntityReferenceString(someString, hostSession); },
+      [&] { return fmt::format("{}", result); });
+  return result;
+}
+
+void TracingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           const ExistsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "entityExists",
+      [&] { return fmt::format("entityReferences={}", summarise(entityReferences)); },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->entityExists(entityReferences, context, hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                           const access::EntityTraitsAccess entityTraitsAccess,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           const EntityTraitsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "entityTraits",
+      [&] {
+        return fmt::format("entityReferences={}, entityTraitsAccess={}",
+                           summarise(entityReferences), accessName(entityTraitsAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context,
+                                        hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                      const trait::TraitSet& traitSet,
+                                      const access::ResolveAccess resolveAccess,
+                                      const ContextConstPtr& context,
+                                      const managerApi::HostSessionPtr& hostSession,
+                                      const ResolveSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "resolve",
+      [&] {
+        return fmt::format("entityReferences={}, traitSet={}, resolveAccess={}",
+                           summarise(entityReferences), summarise(traitSet),
+                           accessName(resolveAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context,
+                                   hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "defaultEntityReference",
+      [&] {
+        return fmt::format("traitSets={}, defaultEntityAccess={}", summarise(traitSets),
+                           accessName(defaultEntityAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context,
+                                                  hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "getWithRelationship",
+      [&] {
+        return fmt::format(
+            "entityReferences={}, relationshipTraitsData={}, resultTraitSet={}, pageSize={},"
+            " relationsAccess={}",
+            summarise(entityReferences), summarise(trait::TraitsDatas{relationshipTraitsData}),
+            summarise(resultTraitSet), pageSize, accessName(relationsAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->getWithRelationship(entityReferences, relationshipTraitsData,
+                                               resultTraitSet, pageSize, relationsAccess,
+                                               context, hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "getWithRelationships",
+      [&] {
+        return fmt::format(
+            "entityReference='{}', relationshipTraitsDatas={}, resultTraitSet={}, pageSize={},"
+            " relationsAccess={}",
+            entityReference.toString(), summarise(relationshipTraitsDatas),
+            summarise(resultTraitSet), pageSize, accessName(relationsAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->getWithRelationships(entityReference, relationshipTraitsDatas,
+                                                resultTraitSet, pageSize, relationsAccess,
+                                                context, hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& traitsHints,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const PreflightSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "preflight",
+      [&] {
+        return fmt::format("entityReferences={}, traitsHints={}, publishingAccess={}",
+                           summarise(entityReferences), summarise(traitsHints),
+                           accessName(publishingAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->preflight(entityReferences, traitsHints, publishingAccess, context,
+                                     hostSession, success, error);
+      });
+}
+
+void TracingManagerInterface::register_(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& entityTraitsDatas,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const RegisterSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  tracedBatch(
+      CallTrace{*this, hostSession}, "register",
+      [&] {
+        return fmt::format("entityReferences={}, entityTraitsDatas={}, publishingAccess={}",
+                           summarise(entityReferences), summarise(entityTraitsDatas),
+                           accessName(publishingAccess));
+      },
+      successCallback, errorCallback, [&](const auto& success, const auto& error) {
+        managerInterface_->register_(entityReferences, entityTraitsDatas, publishingAccess,
+                                     context, hostSession, success, error);
+      });
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
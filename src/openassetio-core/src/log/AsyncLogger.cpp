@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/log/AsyncLogger.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Avoid false sharing between producer and consumer positions.
+constexpr std::size_t kCacheLineSize = 64;
+
+std::size_t nextPowerOfTwo(const std::size_t value) {
+  std::size_t result = 1;
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+}  // namespace
+
+/**
+ * Bounded multi-producer, single-consumer queue, plus the consumer
+ * thread that drains it.
+ *
+ * The queue is a ring buffer of slots, each with a sequence number
+ * that indicates whether the slot is free for the producer at a given
+ * position, or published for the consumer (see Dmitry Vyukov's bounded
+ * MPMC queue). Producers claim a position with a single CAS, so
+ * never block each other, other than when the queue is full.
+ *
+ * Mutexes and condition variables are only used to put the consumer to
+ * sleep when the queue is empty, and blocked producers or flushing
+ * threads to sleep whilst waiting for the consumer. Atomic counters of
+ * sleepers mean the common case doesn't touch them.
+ */
+class AsyncLogger::Impl {
+  struct Slot {
+    std::atomic<std::size_t> sequence{0};
+    Severity severity{Severity::kDebugApi};
+    Str message;
+  };
+
+ public:
+  Impl(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+       const OverflowPolicy overflowPolicy)
+      : upstreamLogger_{std::move(upstreamLogger)},
+        overflowPolicy_{overflowPolicy},
+        capacity_{nextPowerOfTwo(capacity)},
+        slots_{std::make_unique<Slot[]>(capacity_)} {  // NOLINT(*-avoid-c-arrays)
+    for (std::size_t idx = 0; idx < capacity_; ++idx) {
+      // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+      slots_[idx].sequence.store(idx, std::memory_order_relaxed);
+    }
+    // Start last, once all members are initialised.
+    consumer_ = std::thread{[this] { drain(); }};
+  }
+
+  ~Impl() {
+    {
+      const std::lock_guard lock{mutex_};
+      isStopping_ = true;
+    }
+    consumerWake_.notify_one();
+    consumer_.join();
+  }
+
+  Impl(const Impl&) = delete;
+  Impl(Impl&&) noexcept = delete;
+  Impl& operator=(const Impl&) = delete;
+  Impl& operator=(Impl&&) noexcept = delete;
+
+  [[nodiscard]] const LoggerInterfacePtr& upstreamLogger() const { return upstreamLogger_; }
+
+  void push(const Severity severity, const Str& message) {
+    // Copy before claiming a slot, so an allocation failure can't
+    // leave a claimed slot unpublished, stalling the consumer.
+    Str messageCopy = message;
+
+    while (!tryPush(severity, messageCopy)) {
+      if (overflowPolicy_ == OverflowPolicy::kDrop) {
+        numDropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      numBlockedProducers_.fetch_add(1);
+      {
+        std::unique_lock lock{mutex_};
+        spaceAvailable_.wait(lock, [this] {
+          return enqueuePos_.load() - numDelivered_.load() < capacity_;
+        });
+      }
+      numBlockedProducers_.fetch_sub(1);
+    }
+
+    // The message was published with a sequentially consistent store,
+    // so either we see that the consumer is sleeping, or it sees our
+    // message before sleeping.
+    if (isConsumerSleeping_.load()) {
+      const std::lock_guard lock{mutex_};
+      consumerWake_.notify_one();
+    }
+  }
+
+  void flush() {
+    const std::size_t target = enqueuePos_.load();
+    numFlushers_.fetch_add(1);
+    {
+      std::unique_lock lock{mutex_};
+      delivered_.wait(lock, [&] { return numDelivered_.load() >= target; });
+    }
+    numFlushers_.fetch_sub(1);
+  }
+
+  [[nodiscard]] std::size_t droppedCount() const {
+    return numDropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  bool tryPush(const Severity severity, Str& message) {
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+      slot = &slots_[pos & (capacity_ - 1)];
+      const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      if (sequence == pos) {
+        // Slot is free, try to claim it.
+        if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (sequence < pos) {
+        // Slot still holds the message from the previous lap.
+        return false;
+      } else {
+        // Another producer claimed the slot, try again.
+        pos = enqueuePos_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->severity = severity;
+    slot->message = std::move(message);
+    slot->sequence.store(pos + 1);
+    return true;
+  }
+
+  [[nodiscard]] bool isNextPublished() const {
+    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+    return slots_[dequeuePos_ & (capacity_ - 1)].sequence.load() == dequeuePos_ + 1;
+  }
+
+  void drain() {
+    while (true) {
+      while (isNextPublished()) {
+        // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+        Slot& slot = slots_[dequeuePos_ & (capacity_ - 1)];
+        const Severity severity = slot.severity;
+        const Str message = std::move(slot.message);
+        // Free the slot for the producer on the next lap.
+        slot.sequence.store(dequeuePos_ + capacity_, std::memory_order_release);
+        ++dequeuePos_;
+
+        deliver(severity, message);
+        reportDropped();
+        numDelivered_.store(dequeuePos_);
+
+        if (numBlockedProducers_.load() > 0) {
+          const std::lock_guard lock{mutex_};
+          spaceAvailable_.notify_all();
+        }
+        if (numFlushers_.load() > 0) {
+          const std::lock_guard lock{mutex_};
+          delivered_.notify_all();
+        }
+      }
+
+      std::unique_lock lock{mutex_};
+      // Sequentially consistent, pairing with the check in `push`.
+      isConsumerSleeping_.store(true);
+      if (isStopping_ && !isNextPublished()) {
+        return;
+      }
+      consumerWake_.wait(lock, [this] { return isStopping_ || isNextPublished(); });
+      isConsumerSleeping_.store(false);
+    }
+  }
+
+  void deliver(const Severity severity, const Str& message) {
+    try {
+      upstreamLogger_->log(severity, message);
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // Nowhere to report to, and must not kill the thread.
+    }
+  }
+
+  void reportDropped() {
+    const std::size_t numDropped = numDropped_.load(std::memory_order_relaxed);
+    if (numDropped == numDroppedReported_) {
+      return;
+    }
+    deliver(Severity::kWarning,
+            fmt::format("AsyncLogger: {} message(s) dropped due to a full queue",
+                        numDropped - numDroppedReported_));
+    numDroppedReported_ = numDropped;
+  }
+
+  const LoggerInterfacePtr upstreamLogger_;
+  const OverflowPolicy overflowPolicy_;
+  const std::size_t capacity_;
+  const std::unique_ptr<Slot[]> slots_;  // NOLINT(*-avoid-c-arrays)
+
+  alignas(kCacheLineSize) std::atomic<std::size_t> enqueuePos_{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> numDelivered_{0};
+  /// Only accessed by the consumer.
+  std::size_t dequeuePos_{0};
+  std::size_t numDroppedReported_{0};
+
+  std::atomic<std::size_t> numDropped_{0};
+  std::atomic<std::size_t> numBlockedProducers_{0};
+  std::atomic<std::size_t> numFlushers_{0};
+  std::atomic<bool> isConsumerSleeping_{false};
+
+  std::mutex mutex_;
+  std::condition_variable consumerWake_;
+  std::condition_variable spaceAvailable_;
+  std::condition_variable delivered_;
+  /// Guarded by mutex_.
+  bool isStopping_{false};
+
+  std::thread consumer_;
+};
+
+AsyncLoggerPtr AsyncLogger::make(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                                 const OverflowPolicy overflowPolicy) {
+  if (!upstreamLogger) {
+    throw errors::InputValidationException{"AsyncLogger: Upstream logger cannot be null"};
+  }
+  if (capacity == 0) {
+    throw errors::InputValidationException{"AsyncLogger: Capacity must be greater than zero"};
+  }
+  return std::shared_ptr<AsyncLogger>(new AsyncLogger{
+      std::make_unique<Impl>(std::move(upstreamLogger), capacity, overflowPolicy)});
+}
+
+AsyncLogger::AsyncLogger(std::unique_ptr<Impl> impl) : impl_{std::move(impl)} {}
+
+AsyncLogger::~AsyncLogger() = default;
+
+LoggerInterfacePtr AsyncLogger::upstreamLogger() const { return impl_->upstreamLogger(); }
+
+void AsyncLogger::log(const Severity severity, const Str& message) {
+  if (!impl_->upstreamLogger()->isSeverityLogged(severity)) {
+    return;
+  }
+  impl_->push(severity, message);
+}
+
+bool AsyncLogger::isSeverityLogged(const Severity severity) const {
+  return impl_->upstreamLogger()->isSeverityLogged(severity);
+}
+
+void AsyncLogger::flush() { impl_->flush(); }
+
+std::size_t AsyncLogger::droppedCount() const { return impl_->droppedCount(); }
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
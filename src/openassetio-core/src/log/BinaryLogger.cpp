@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/log/BinaryLogger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/chrono.h>
+#include <fmt/core.h>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Identifies a BinaryLogger file, and the version of its format.
+constexpr std::string_view kMagic{"OAIOLOG1"};
+
+// Record layout, in native byte order.
+using TimestampField = std::int64_t;
+using ThreadIndexField = std::uint32_t;
+using SeverityField = std::uint8_t;
+using LengthField = std::uint32_t;
+constexpr std::size_t kRecordHeaderSize = sizeof(TimestampField) + sizeof(ThreadIndexField) +
+                                          sizeof(SeverityField) + sizeof(LengthField);
+
+/// Source of IDs unique to each instance, for thread-local caching.
+std::atomic<std::uint64_t> gNextInstanceId{1};
+
+template <class Field>
+void appendField(std::vector<char>& buffer, const Field value) {
+  std::array<char, sizeof(Field)> bytes{};
+  std::memcpy(bytes.data(), &value, sizeof(Field));
+  buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+}
+
+template <class Field>
+Field readField(const char* data) {
+  Field value{};
+  std::memcpy(&value, data, sizeof(Field));
+  return value;
+}
+
+/**
+ * Records appended by a single thread, pending writing to the file.
+ *
+ * The mutex is only contended whilst another thread flushes.
+ */
+struct ThreadBuffer {
+  std::mutex mutex;
+  std::vector<char> data;
+  ThreadIndexField threadIndex{0};
+};
+
+/**
+ * The file of a BinaryLogger, and the thread buffers pending writing
+ * to it.
+ *
+ * Shared with the threads that own the buffers, so that a thread can
+ * write its buffer on exit, even if racing destruction of the logger.
+ */
+class Sink {
+ public:
+  explicit Sink(const Str& filePath) {
+    // Thread buffers already batch writes, so avoid a second copy.
+    file_.rdbuf()->pubsetbuf(nullptr, 0);
+    file_.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+      throw errors::InputValidationException{
+          fmt::format("BinaryLogger: Unable to open '{}' for writing", filePath)};
+    }
+    file_.write(kMagic.data(), static_cast<std::streamsize>(kMagic.size()));
+  }
+
+  /// Register a new buffer, assigning it the next thread index.
+  void registerBuffer(ThreadBuffer& buffer) {
+    const std::lock_guard lock{buffersMutex_};
+    buffer.threadIndex = nextThreadIndex_++;
+    buffers_.insert(&buffer);
+  }
+
+  /// Write and unregister a buffer, prior to its destruction.
+  void releaseBuffer(ThreadBuffer& buffer) {
+    const std::lock_guard buffersLock{buffersMutex_};
+    buffers_.erase(&buffer);
+    const std::lock_guard lock{buffer.mutex};
+    write(buffer.data);
+  }
+
+  void flush() {
+    const std::lock_guard buffersLock{buffersMutex_};
+    for (ThreadBuffer* buffer : buffers_) {
+      const std::lock_guard lock{buffer->mutex};
+      write(buffer->data);
+    }
+    const std::lock_guard fileLock{fileMutex_};
+    file_.flush();
+  }
+
+  /// Write and clear a buffer. Requires the buffer's mutex.
+  void write(std::vector<char>& data) {
+    if (data.empty()) {
+      return;
+    }
+    {
+      const std::lock_guard lock{fileMutex_};
+      file_.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    data.clear();
+  }
+
+ private:
+  /// Guards file_.
+  std::mutex fileMutex_;
+  std::ofstream file_;
+
+  /// Guards buffers_ and nextThreadIndex_, but not buffer content.
+  std::mutex buffersMutex_;
+  std::unordered_set<ThreadBuffer*> buffers_;
+  /// Indices are never reused, so records of threads are never merged.
+  ThreadIndexField nextThreadIndex_{0};
+};
+
+/**
+ * The buffers of the current thread, one per BinaryLogger it has
+ * logged to.
+ *
+ * On thread exit, each buffer is written to its logger's file, if the
+ * logger still exists, and unregistered from it.
+ */
+class ThreadBuffers {
+ public:
+  ThreadBuffers() = default;
+
+  ~ThreadBuffers() {
+    for (auto& entry : entries_) {
+      if (const auto sink = entry.sink.lock()) {
+        sink->releaseBuffer(*entry.buffer);
+      }
+    }
+  }
+
+  ThreadBuffers(const ThreadBuffers&) = delete;
+  ThreadBuffers(ThreadBuffers&&) noexcept = delete;
+  ThreadBuffers& operator=(const ThreadBuffers&) = delete;
+  ThreadBuffers& operator=(ThreadBuffers&&) noexcept = delete;
+
+  /// Get the buffer for a logger instance, creating it if necessary.
+  ThreadBuffer& bufferFor(const std::uint64_t instanceId, const std::shared_ptr<Sink>& sink,
+                          const std::size_t bufferSize) {
+    // Typically a thread logs to a single logger, so check the most
+    // recently created buffer first.
+    for (auto entry = entries_.rbegin(); entry != entries_.rend(); ++entry) {
+      if (entry->instanceId == instanceId) {
+        return *entry->buffer;
+      }
+    }
+
+    // Buffers of destroyed loggers were written on destruction.
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                  [](const Entry& entry) { return entry.sink.expired(); }),
+                   entries_.end());
+
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->data.reserve(bufferSize);
+    sink->registerBuffer(*buffer);
+    entries_.push_back({instanceId, sink, std::move(buffer)});
+    return *entries_.back().buffer;
+  }
+
+ private:
+  struct Entry {
+    // Instance IDs are never reused, so a stale entry for a destroyed
+    // instance can never match.
+    std::uint64_t instanceId;
+    std::weak_ptr<Sink> sink;
+    std::unique_ptr<ThreadBuffer> buffer;
+  };
+  std::vector<Entry> entries_;
+};
+
+thread_local ThreadBuffers tThreadBuffers;
+}  // namespace
+
+class BinaryLogger::Impl {
+ public:
+  Impl(Str filePath, const std::size_t threadBufferSize)
+      : filePath_{std::move(filePath)},
+        threadBufferSize_{threadBufferSize},
+        sink_{std::make_shared<Sink>(filePath_)} {}
+
+  ~Impl() { flush(); }
+
+  Impl(const Impl&) = delete;
+  Impl(Impl&&) noexcept = delete;
+  Impl& operator=(const Impl&) = delete;
+  Impl& operator=(Impl&&) noexcept = delete;
+
+  void log(const Severity severity, const Str& message) {
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+    ThreadBuffer& buffer = tThreadBuffers.bufferFor(instanceId_, sink_, threadBufferSize_);
+    const std::lock_guard lock{buffer.mutex};
+
+    appendField(buffer.data, static_cast<TimestampField>(timestamp));
+    appendField(buffer.data, buffer.threadIndex);
+    appendField(buffer.data, static_cast<SeverityField>(severity));
+    appendField(buffer.data, static_cast<LengthField>(message.size()));
+    buffer.data.insert(buffer.data.end(), message.begin(), message.end());
+
+    if (buffer.data.size() >= threadBufferSize_) {
+      sink_->write(buffer.data);
+    }
+  }
+
+  void flush() { sink_->flush(); }
+
+  [[nodiscard]] const Str& filePath() const { return filePath_; }
+
+ private:
+  const Str filePath_;
+  const std::size_t threadBufferSize_;
+  const std::uint64_t instanceId_{gNextInstanceId.fetch_add(1, std::memory_order_relaxed)};
+  const std::shared_ptr<Sink> sink_;
+};
+
+BinaryLoggerPtr BinaryLogger::make(const Str& filePath, const std::size_t threadBufferSize) {
+  return std::shared_ptr<BinaryLogger>(
+      new BinaryLogger{std::make_unique<Impl>(filePath, threadBufferSize)});
+}
+
+BinaryLogger::BinaryLogger(std::unique_ptr<Impl> impl) : impl_{std::move(impl)} {}
+
+BinaryLogger::~BinaryLogger() = default;
+
+void BinaryLogger::log(const Severity severity, const Str& message) {
+  impl_->log(severity, message);
+}
+
+void BinaryLogger::flush() { impl_->flush(); }
+
+const Str& BinaryLogger::filePath() const { return impl_->filePath(); }
+
+BinaryLogger::Records BinaryLogger::decode(const Str& filePath) {
+  std::ifstream file{filePath, std::ios::binary};
+  if (!file) {
+    throw errors::InputValidationException{
+        fmt::format("BinaryLogger: Unable to open '{}' for reading", filePath)};
+  }
+  const std::vector<char> data{std::istreambuf_iterator<char>{file},
+                               std::istreambuf_iterator<char>{}};
+
+  if (data.size() < kMagic.size() ||
+      std::string_view{data.data(), kMagic.size()} != kMagic) {
+    throw errors::InputValidationException{
+        fmt::format("BinaryLogger: '{}' is not a BinaryLogger file", filePath)};
+  }
+
+  Records records;
+  std::size_t offset = kMagic.size();
+  while (data.size() - offset >= kRecordHeaderSize) {
+    const char* header = &data[offset];
+    const auto timestamp = readField<TimestampField>(header);
+    header += sizeof(TimestampField);
+    const auto threadIndex = readField<ThreadIndexField>(header);
+    header += sizeof(ThreadIndexField);
+    const auto severity = readField<SeverityField>(header);
+    header += sizeof(SeverityField);
+    const auto length = readField<LengthField>(header);
+
+    if (severity > static_cast<SeverityField>(Severity::kCritical) ||
+        data.size() - offset - kRecordHeaderSize < length) {
+      // Corrupt or truncated.
+      break;
+    }
+    offset += kRecordHeaderSize;
+    records.push_back({std::chrono::nanoseconds{timestamp}, threadIndex,
+                       static_cast<Severity>(severity), Str{&data[offset], length}});
+    offset += length;
+  }
+
+  // Records are written a thread buffer at a time, so interleave.
+  std::stable_sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+    return lhs.timeSinceEpoch < rhs.timeSinceEpoch;
+  });
+  return records;
+}
+
+Str BinaryLogger::formatRecord(const Record& record) {
+  const auto severityIdx = static_cast<std::size_t>(record.severity);
+  if (severityIdx >= kSeverityNames.size()) {
+    throw errors::InputValidationException{
+        fmt::format("BinaryLogger: Invalid severity {}", severityIdx)};
+  }
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(record.timeSinceEpoch);
+  const auto nanoseconds = record.timeSinceEpoch - seconds;
+  return fmt::format("{:%Y-%m-%dT%H:%M:%S}.{:09d}Z [{}] {}: {}",
+                     fmt::gmtime(static_cast<std::time_t>(seconds.count())), nanoseconds.count(),
+                     record.threadIndex, kSeverityNames[severityIdx], record.message);
+}
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
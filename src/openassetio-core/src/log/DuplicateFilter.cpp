@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/log/DuplicateFilter.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Number of recent messages tracked. Must be a power of two.
+constexpr std::size_t kNumSlots = 64;
+
+/// Key reserved for a slot that has never been used.
+constexpr std::uint64_t kNoKey = 0;
+
+/// Due time used when no summary is pending.
+constexpr std::int64_t kNeverDue = std::numeric_limits<std::int64_t>::max();
+
+/// A message to relay once a lock has been released.
+struct PendingMessage {
+  LoggerInterface::Severity severity;
+  Str message;
+};
+
+/**
+ * Most recent message to hash to a slot, and any suppressed repeats.
+ *
+ * `key` and `windowStart` are read without locking to detect
+ * non-duplicates. All else is guarded by `mutex`.
+ */
+struct Slot {
+  std::atomic<std::uint64_t> key{kNoKey};
+  /// Time since steady clock epoch, in nanoseconds.
+  std::atomic<std::int64_t> windowStart{0};
+  /// Whether numSuppressed is non-zero.
+  std::atomic<bool> hasSuppressed{false};
+
+  std::mutex mutex;
+  std::uint64_t suppressedKey{kNoKey};
+  LoggerInterface::Severity suppressedSeverity{LoggerInterface::Severity::kDebugApi};
+  Str suppressedMessage;
+  std::size_t numSuppressed{0};
+
+  /// Take a summary of suppressed messages. Requires mutex.
+  std::optional<PendingMessage> takeSummary() {
+    if (numSuppressed == 0) {
+      return std::nullopt;
+    }
+    PendingMessage summary{suppressedSeverity,
+                           fmt::format("{} (repeated {} more time{})", suppressedMessage,
+                                       numSuppressed, numSuppressed == 1 ? "" : "s")};
+    numSuppressed = 0;
+    hasSuppressed.store(false);
+    return summary;
+  }
+};
+
+std::uint64_t messageKey(const LoggerInterface::Severity severity, const Str& message) {
+  // Mix severity in using the 64-bit golden ratio.
+  const std::uint64_t key = std::hash<Str>{}(message) ^
+                            ((static_cast<std::uint64_t>(severity) + 1) * 0x9e3779b97f4a7c15ULL);
+  return key == kNoKey ? 1 : key;
+}
+}  // namespace
+
+class DuplicateFilter::Impl {
+ public:
+  Impl(LoggerInterfacePtr upstreamLogger, const std::chrono::milliseconds window)
+      : upstreamLogger_{std::move(upstreamLogger)},
+        window_{window},
+        windowNs_{std::chrono::duration_cast<std::chrono::nanoseconds>(window).count()} {}
+
+  ~Impl() { flush(); }
+
+  Impl(const Impl&) = delete;
+  Impl(Impl&&) noexcept = delete;
+  Impl& operator=(const Impl&) = delete;
+  Impl& operator=(Impl&&) noexcept = delete;
+
+  void log(const Severity severity, const Str& message) {
+    const std::uint64_t key = messageKey(severity, message);
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count();
+    if (now >= nextSummaryDue_.load()) {
+      relayExpiredSummaries(now);
+    }
+    Slot& slot = slots_[key & (kNumSlots - 1)];
+
+    const bool isDuplicate = slot.key.load() == key && now - slot.windowStart.load() < windowNs_;
+    if (!isDuplicate && !slot.hasSuppressed.load()) {
+      // Fast path: nothing to count, and no summary to relay.
+      slot.windowStart.store(now);
+      slot.key.store(key);
+      upstreamLogger_->log(severity, message);
+      return;
+    }
+
+    std::optional<PendingMessage> summary;
+    bool shouldRelay = false;
+    {
+      const std::lock_guard lock{slot.mutex};
+      // Re-check, since the slot may have been claimed in the interim.
+      if (slot.key.load() == key && now - slot.windowStart.load() < windowNs_) {
+        if (slot.suppressedKey != key) {
+          summary = slot.takeSummary();
+        }
+        const bool isFirstSuppressed = slot.numSuppressed == 0;
+        if (isFirstSuppressed) {
+          slot.suppressedKey = key;
+          slot.suppressedSeverity = severity;
+          slot.suppressedMessage = message;
+        }
+        ++slot.numSuppressed;
+        slot.hasSuppressed.store(true);
+        if (isFirstSuppressed) {
+          // After hasSuppressed is set, so a concurrent scan that
+          // resets the schedule will find this slot.
+          scheduleSummary(slot.windowStart.load() + windowNs_);
+        }
+      } else {
+        summary = slot.takeSummary();
+        slot.windowStart.store(now);
+        slot.key.store(key);
+        shouldRelay = true;
+      }
+    }
+
+    if (summary) {
+      upstreamLogger_->log(summary->severity, summary->message);
+    }
+    if (shouldRelay) {
+      upstreamLogger_->log(severity, message);
+    }
+  }
+
+  void flush() {
+    std::vector<PendingMessage> summaries;
+    for (Slot& slot : slots_) {
+      if (!slot.hasSuppressed.load()) {
+        continue;
+      }
+      const std::lock_guard lock{slot.mutex};
+      if (auto summary = slot.takeSummary()) {
+        summaries.push_back(std::move(*summary));
+      }
+    }
+    for (const auto& [severity, message] : summaries) {
+      upstreamLogger_->log(severity, message);
+    }
+  }
+
+  [[nodiscard]] const LoggerInterfacePtr& upstreamLogger() const { return upstreamLogger_; }
+  [[nodiscard]] std::chrono::milliseconds window() const { return window_; }
+
+ private:
+  /// Bring forward the time the next summary is due, if later.
+  void scheduleSummary(const std::int64_t due) {
+    std::int64_t current = nextSummaryDue_.load();
+    while (due < current && !nextSummaryDue_.compare_exchange_weak(current, due)) {
+    }
+  }
+
+  /**
+   * Relay summaries of suppressed messages whose window has elapsed,
+   * such that they are not held indefinitely if the message is not
+   * logged again.
+   */
+  void relayExpiredSummaries(const std::int64_t now) {
+    // Only one thread need scan at a time.
+    const std::unique_lock scanLock{scanMutex_, std::try_to_lock};
+    if (!scanLock) {
+      return;
+    }
+    // Reset before scanning, so summaries scheduled concurrently are
+    // either found by the scan or re-schedule themselves.
+    nextSummaryDue_.store(kNeverDue);
+
+    std::vector<PendingMessage> summaries;
+    for (Slot& slot : slots_) {
+      if (!slot.hasSuppressed.load()) {
+        continue;
+      }
+      const std::lock_guard lock{slot.mutex};
+      const std::int64_t due = slot.windowStart.load() + windowNs_;
+      if (now < due) {
+        scheduleSummary(due);
+      } else if (auto summary = slot.takeSummary()) {
+        summaries.push_back(std::move(*summary));
+      }
+    }
+    for (const auto& [severity, message] : summaries) {
+      upstreamLogger_->log(severity, message);
+    }
+  }
+
+  const LoggerInterfacePtr upstreamLogger_;
+  const std::chrono::milliseconds window_;
+  const std::int64_t windowNs_;
+  std::array<Slot, kNumSlots> slots_;
+  /// Earliest time, since steady clock epoch, that a summary is due.
+  std::atomic<std::int64_t> nextSummaryDue_{kNeverDue};
+  /// Held whilst scanning for expired summaries.
+  std::mutex scanMutex_;
+};
+
+DuplicateFilterPtr DuplicateFilter::make(LoggerInterfacePtr upstreamLogger,
+                                         const std::chrono::milliseconds window) {
+  if (!upstreamLogger) {
+    throw errors::InputValidationException{"DuplicateFilter: Upstream logger cannot be null"};
+  }
+  if (window.count() <= 0) {
+    throw errors::InputValidationException{"DuplicateFilter: Window must be greater than zero"};
+  }
+  return std::shared_ptr<DuplicateFilter>(
+      new DuplicateFilter{std::make_unique<Impl>(std::move(upstreamLogger), window)});
+}
+
+DuplicateFilter::DuplicateFilter(std::unique_ptr<Impl> impl) : impl_{std::move(impl)} {}
+
+DuplicateFilter::~DuplicateFilter() = default;
+
+LoggerInterfacePtr DuplicateFilter::upstreamLogger() const { return impl_->upstreamLogger(); }
+
+std::chrono::milliseconds DuplicateFilter::window() const { return impl_->window(); }
+
+void DuplicateFilter::log(const Severity severity, const Str& message) {
+  if (!impl_->upstreamLogger()->isSeverityLogged(severity)) {
+    return;
+  }
+  impl_->log(severity, message);
+}
+
+bool DuplicateFilter::isSeverityLogged(const Severity severity) const {
+  return impl_->upstreamLogger()->isSeverityLogged(severity);
+}
+
+void DuplicateFilter::flush() { impl_->flush(); }
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
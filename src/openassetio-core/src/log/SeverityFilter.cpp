@@ -2,8 +2,11 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #include <openassetio/log/SeverityFilter.hpp>
 
+#include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -14,6 +17,47 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace log {
+/**
+ * Threshold for a named source, shared with its SourceLogger.
+ */
+struct SeverityFilter::SourceState {
+  static constexpr int kUnset = -1;
+  /// Severity as int, or kUnset to defer to the filter's severity.
+  std::atomic<int> minSeverity{kUnset};
+  /// Cached logger, guarded by sourcesMutex_. Weak, since the logger
+  /// holds the filter, which holds this state.
+  std::weak_ptr<SourceLogger> logger;
+};
+
+/**
+ * Logger that filters by a source's threshold before relaying to the
+ * filter's upstream logger.
+ */
+class SeverityFilter::SourceLogger final : public LoggerInterface {
+ public:
+  SourceLogger(SeverityFilterPtr filter, std::shared_ptr<SourceState> state)
+      : filter_{std::move(filter)}, state_{std::move(state)} {}
+
+  void log(const Severity severity, const Str& message) override {
+    if (!isSeverityLogged(severity)) {
+      return;
+    }
+    filter_->upstreamLogger_->log(severity, message);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    const int sourceSeverity = state_->minSeverity.load(std::memory_order_relaxed);
+    const Severity minSeverity = sourceSeverity == SourceState::kUnset
+                                     ? filter_->minSeverity_.load(std::memory_order_relaxed)
+                                     : static_cast<Severity>(sourceSeverity);
+    return severity >= minSeverity && filter_->upstreamLogger_->isSeverityLogged(severity);
+  }
+
+ private:
+  SeverityFilterPtr filter_;
+  std::shared_ptr<SourceState> state_;
+};
+
 SeverityFilterPtr SeverityFilter::make(LoggerInterfacePtr upstreamLogger) {
   return std::shared_ptr<SeverityFilter>(new SeverityFilter(std::move(upstreamLogger)));
 }
@@ -32,26 +76,78 @@ SeverityFilter::SeverityFilter(LoggerInterfacePtr upstreamLogger)
       msg += "' - ignoring.";
       upstreamLogger_->log(Severity::kError, msg);
     } else {
-      minSeverity_ = static_cast<Severity>(envSeverity);
+      minSeverity_.store(static_cast<Severity>(envSeverity), std::memory_order_relaxed);
     }
   }
 }
 
 void SeverityFilter::log(const Severity severity, const Str& message) {
-  if (severity < minSeverity_ || !upstreamLogger_->isSeverityLogged(severity)) {
+  if (!isSeverityLogged(severity)) {
     return;
   }
   upstreamLogger_->log(severity, message);
 }
 
-void SeverityFilter::setSeverity(const Severity severity) { minSeverity_ = severity; }
+void SeverityFilter::setSeverity(const Severity severity) {
+  minSeverity_.store(severity, std::memory_order_relaxed);
+}
 
-LoggerInterface::Severity SeverityFilter::getSeverity() const { return minSeverity_; }
+LoggerInterface::Severity SeverityFilter::getSeverity() const {
+  return minSeverity_.load(std::memory_order_relaxed);
+}
 
 LoggerInterfacePtr SeverityFilter::upstreamLogger() const { return upstreamLogger_; }
 
 bool SeverityFilter::isSeverityLogged(const Severity severity) const {
-  return severity >= minSeverity_ && upstreamLogger_->isSeverityLogged(severity);
+  return severity >= minSeverity_.load(std::memory_order_relaxed) &&
+         upstreamLogger_->isSeverityLogged(severity);
+}
+
+LoggerInterfacePtr SeverityFilter::sourceLogger(const Str& source) {
+  const std::lock_guard lock{sourcesMutex_};
+  const std::shared_ptr<SourceState>& state = sourceState(source);
+  if (auto logger = state->logger.lock()) {
+    return logger;
+  }
+  auto logger = std::make_shared<SourceLogger>(shared_from_this(), state);
+  state->logger = logger;
+  return logger;
+}
+
+void SeverityFilter::setSourceSeverity(const Str& source, const Severity severity) {
+  const std::lock_guard lock{sourcesMutex_};
+  sourceState(source)->minSeverity.store(static_cast<int>(severity), std::memory_order_relaxed);
+}
+
+std::optional<LoggerInterface::Severity> SeverityFilter::getSourceSeverity(
+    const Str& source) const {
+  const std::lock_guard lock{sourcesMutex_};
+  const auto iter = sources_.find(source);
+  if (iter == sources_.end()) {
+    return std::nullopt;
+  }
+  const int sourceSeverity = iter->second->minSeverity.load(std::memory_order_relaxed);
+  if (sourceSeverity == SourceState::kUnset) {
+    return std::nullopt;
+  }
+  return static_cast<Severity>(sourceSeverity);
+}
+
+void SeverityFilter::resetSourceSeverity(const Str& source) {
+  const std::lock_guard lock{sourcesMutex_};
+  if (const auto iter = sources_.find(source); iter != sources_.end()) {
+    // Retain the state, since existing source loggers share it.
+    iter->second->minSeverity.store(SourceState::kUnset, std::memory_order_relaxed);
+  }
+}
+
+const std::shared_ptr<SeverityFilter::SourceState>& SeverityFilter::sourceState(
+    const Str& source) {
+  auto& state = sources_[source];
+  if (!state) {
+    state = std::make_shared<SourceState>();
+  }
+  return state;
 }
 }  // namespace log
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
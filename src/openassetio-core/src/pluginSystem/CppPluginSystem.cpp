@@ -127,8 +127,10 @@ void CppPluginSystem::scan(const std::string_view paths, const std::string_view
 
       // Check the provided path is actually a searchable directory.
       if (!is_directory(directoryPath)) {
-        logger_->debug(fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
-                                   directoryPath.string()));
+        logger_->debug([&] {
+          return fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
+                             directoryPath.string());
+        });
         continue;
       }
 
@@ -141,8 +143,10 @@ void CppPluginSystem::scan(const std::string_view paths, const std::string_view
         // to load it.
         if (MaybeIdentifierAndPlugin idAndPlugin =
                 maybeLoadPlugin(filePath, moduleHookName, validationCallback)) {
-          logger_->debug(fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
-                                     idAndPlugin->first, filePath.string()));
+          logger_->debug([&] {
+            return fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
+                               idAndPlugin->first, filePath.string());
+          });
           // Register the successfully loaded plugin.
           plugins_[std::move(idAndPlugin->first)] = {std::move(filePath),
                                                      std::move(idAndPlugin->second)};
@@ -168,9 +172,11 @@ void CppPluginSystem::scan(const std::string_view paths, const std::string_view
     }();
 
     if (pathsFromEnvVar.empty()) {
-      logger_->debug(fmt::format(
-          "CppPluginSystem: No search paths specified, no plugins will load - check ${} is set",
-          pathsEnvVar));
+      logger_->debug([&] {
+        return fmt::format(
+            "CppPluginSystem: No search paths specified, no plugins will load - check ${} is set",
+            pathsEnvVar);
+      });
     } else {
       scanPaths(pathsFromEnvVar);
     }
@@ -200,15 +206,19 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
     const ValidationCallback& validationCallback) {
   // Check the proposed path is actually a file.
   if (!is_regular_file(filePath)) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
+    logger_->debug([&] {
+      return fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                         filePath.string());
+    });
     return {};
   }
 
   // Check the proposed file name looks like a shared library.
   if (filePath.extension() != kLibExt) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
+    logger_->debug([&] {
+      return fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                         filePath.string());
+    });
     return {};
   }
 
@@ -224,8 +234,12 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   void* handle = dlopen(filePath.c_str(), RTLD_LAZY | RTLD_LOCAL);
 
   if (!handle) {
-    logger_->debug(fmt::format("CppPluginSystem: Failed to open library '{}': {}",
-                               filePath.string(), dlerror()));
+    // Retrieve eagerly, since it also clears the error state.
+    const auto error = dlerror();
+    logger_->debug([&] {
+      return fmt::format("CppPluginSystem: Failed to open library '{}': {}", filePath.string(),
+                         error);
+    });
     return {};
   }
 
@@ -233,8 +247,11 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   // NOLINTNEXTLINE(*-suspicious-stringview-data-usage)
   void* entrypoint = dlsym(handle, moduleHookName.data());
   if (!entrypoint) {
-    logger_->debug(fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
-                               moduleHookName, filePath.string(), dlerror()));
+    const auto error = dlerror();
+    logger_->debug([&] {
+      return fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
+                         moduleHookName, filePath.string(), error);
+    });
     dlclose(handle);
     return {};
   }
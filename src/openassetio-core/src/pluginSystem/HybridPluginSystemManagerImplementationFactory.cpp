@@ -5,8 +5,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <iterator>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -19,10 +21,14 @@
 #include <openassetio/access.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../utils/concurrency.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace pluginSystem {
@@ -42,13 +48,19 @@ namespace {
  * For API calls that have no associated capability, either the first
  * child is chosen, or the results from all children are merged - see
  * method-specific docs for details.
+ *
+ * If constructed with `concurrentLifecycle`, then `initialize` and
+ * `flushCaches` are called on all children concurrently, rather than
+ * in priority order.
  */
 class HybridManagerInterface final : public managerApi::ManagerInterface {
   using ManagerInterfaces = std::vector<managerApi::ManagerInterfacePtr>;
 
  public:
-  explicit HybridManagerInterface(ManagerInterfaces managerInterfacess)
-      : managerInterfaces_{std::move(managerInterfacess)} {
+  explicit HybridManagerInterface(ManagerInterfaces managerInterfacess,
+                                  const bool concurrentLifecycle)
+      : managerInterfaces_{std::move(managerInterfacess)},
+        concurrentLifecycle_{concurrentLifecycle} {
     // Precondition.
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
     assert(!managerInterfaces_.empty());
@@ -107,16 +119,16 @@ class HybridManagerInterface final : public managerApi::ManagerInterface {
    * All child implementations are initialized with the all the same
    * settings.
    *
-   * Once initialization of child implementations is complete, a mapping
-   * of capability to implementation is constructed, which will be used
-   * to dispatch to the appropriate implementation in subsequent API
-   * methods.
+   * Once initialization of all child implementations is complete, a
+   * mapping of capability to implementation is constructed, which will
+   * be used to dispatch to the appropriate implementation in
+   * subsequent API methods.
    */
   void initialize(const InfoDictionary managerSettings,
                   const managerApi::HostSessionPtr& hostSession) override {
-    for (const auto& managerInterface : managerInterfaces_) {
+    forEachManagerInterface("initialize", hostSession, [&](const auto& managerInterface) {
       managerInterface->initialize(managerSettings, hostSession);
-    }
+    });
     // Cache a mapping of the first child interface that supports each
     // capability.
     //
@@ -126,6 +138,7 @@ class HybridManagerInterface final : public managerApi::ManagerInterface {
     // is required, or we are calling out to Python and locking the
     // GIL, etc. The disadvantage is that capabilities cannot change
     // after plugins have been loaded.
+    managerInterfacesByCapability_.clear();
     managerInterfacesByCapability_.reserve(kCapabilityNames.size());
     for (std::size_t capabilityIdx = 0; capabilityIdx < kCapabilityNames.size(); ++capabilityIdx) {
       const auto capability = static_cast<Capability>(capabilityIdx);
@@ -142,9 +155,9 @@ class HybridManagerInterface final : public managerApi::ManagerInterface {
    * All child implementations flushed.
    */
   void flushCaches(const managerApi::HostSessionPtr& hostSession) override {
-    for (const auto& managerInterface : managerInterfaces_) {
+    forEachManagerInterface("flushCaches", hostSession, [&](const auto& managerInterface) {
       managerInterface->flushCaches(hostSession);
-    }
+    });
   }
 
   /*
@@ -302,26 +315,81 @@ class HybridManagerInterface final : public managerApi::ManagerInterface {
   }
 
  private:
+  /**
+   * Call `func` with each child, either in priority order or
+   * concurrently, depending on `concurrentLifecycle_`.
+   *
+   * When concurrent, all calls are allowed to complete, after which the
+   * exception from the highest priority child that failed (if any) is
+   * re-thrown. Exceptions from any other failing children are logged.
+   */
+  template <class Func>
+  void forEachManagerInterface(const std::string_view methodName,
+                               const managerApi::HostSessionPtr& hostSession, const Func& func) {
+    if (!concurrentLifecycle_) {
+      for (const auto& managerInterface : managerInterfaces_) {
+        func(managerInterface);
+      }
+      return;
+    }
+
+    const std::vector<std::exception_ptr> exceptions = utils::invokeConcurrently(
+        managerInterfaces_.size(),
+        [&](const std::size_t idx) { func(managerInterfaces_[idx]); });
+
+    std::exception_ptr firstException;
+    for (std::size_t idx = 0; idx < exceptions.size(); ++idx) {
+      if (!exceptions[idx]) {
+        continue;
+      }
+      if (!firstException) {
+        firstException = exceptions[idx];
+        continue;
+      }
+      try {
+        std::rethrow_exception(exceptions[idx]);
+      } catch (const std::exception& exc) {
+        hostSession->logger()->error(
+            fmt::format("HybridPluginSystem: {} also failed for child manager '{}': {}",
+                        methodName, managerInterfaces_[idx]->displayName(), exc.what()));
+      } catch (...) {
+        hostSession->logger()->error(
+            fmt::format("HybridPluginSystem: {} also failed for child manager '{}'", methodName,
+                        managerInterfaces_[idx]->displayName()));
+      }
+    }
+
+    if (firstException) {
+      std::rethrow_exception(firstException);
+    }
+  }
+
   ManagerInterfaces managerInterfaces_;
+  bool concurrentLifecycle_;
   std::unordered_map<Capability, managerApi::ManagerInterfacePtr> managerInterfacesByCapability_;
 };
 }  // namespace
 
 HybridPluginSystemManagerImplementationFactoryPtr
 HybridPluginSystemManagerImplementationFactory::make(
-    ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger) {
+    ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger,
+    const bool concurrentLifecycle) {
   if (factories.empty()) {
     throw errors::InputValidationException{
         "HybridPluginSystem: At least one child manager implementation factory must be provided"};
   }
 
   return std::make_shared<HybridPluginSystemManagerImplementationFactory>(
-      HybridPluginSystemManagerImplementationFactory{std::move(factories), std::move(logger)});
+      HybridPluginSystemManagerImplementationFactory{std::move(factories), std::move(logger),
+                                                     concurrentLifecycle});
 }
 
 HybridPluginSystemManagerImplementationFactory::HybridPluginSystemManagerImplementationFactory(
-    ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger)
-    : ManagerImplementationFactoryInterface{std::move(logger)}, factories_{std::move(factories)} {}
+    ManagerImplementationFactoryInterfaces factories, log::LoggerInterfacePtr logger,
+    const bool concurrentLifecycle)
+    : ManagerImplementationFactoryInterface{std::move(logger)},
+      factories_{std::move(factories)},
+      concurrentLifecycle_{concurrentLifecycle} {}
 
 Identifiers HybridPluginSystemManagerImplementationFactory::identifiers() {
   Identifiers identifiers;
@@ -358,7 +426,8 @@ managerApi::ManagerInterfacePtr HybridPluginSystemManagerImplementationFactory::
     return std::move(managerInterfaces[0]);
   }
 
-  return std::make_shared<HybridManagerInterface>(std::move(managerInterfaces));
+  return std::make_shared<HybridManagerInterface>(std::move(managerInterfaces),
+                                                  concurrentLifecycle_);
 }
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -2,13 +2,16 @@
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #include "Regex.hpp"
 
+#include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <type_traits>
 
 #include <fmt/core.h>
+#include <fmt/format.h>
 #include <pcre2.h>
 
 #include <openassetio/export.h>
@@ -22,6 +25,68 @@ namespace utils {
 namespace {
 constexpr Str::size_type kErrorMessageMaxLength = 1000;
 
+/**
+ * Pool of match data buffers, for re-use across matches on a single
+ * thread.
+ *
+ * Buffers are not specific to a pattern, only requiring enough space
+ * for its capture groups, so can be shared by all regexes.
+ */
+class MatchDataPool {
+ public:
+  MatchDataPool() = default;
+  ~MatchDataPool() {
+    for (std::size_t idx = 0; idx < numFree_; ++idx) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      pcre2_match_data_free(free_[idx]);
+    }
+  }
+  MatchDataPool(const MatchDataPool&) = delete;
+  MatchDataPool(MatchDataPool&&) noexcept = delete;
+  MatchDataPool& operator=(const MatchDataPool&) = delete;
+  MatchDataPool& operator=(MatchDataPool&&) noexcept = delete;
+
+  pcre2_match_data* acquire(const std::uint32_t numPairs) {
+    // Most recently released first, since it is most likely to be in
+    // cache.
+    for (std::size_t idx = numFree_; idx-- > 0;) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      pcre2_match_data* data = free_[idx];
+      if (pcre2_get_ovector_count(data) >= numPairs) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        free_[idx] = free_[--numFree_];
+        return data;
+      }
+    }
+    return pcre2_match_data_create(numPairs, nullptr);
+  }
+
+  void release(pcre2_match_data* data) noexcept {
+    if (numFree_ < free_.size()) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      free_[numFree_++] = data;
+    } else {
+      pcre2_match_data_free(data);
+    }
+  }
+
+ private:
+  /// Enough for the deepest nesting of live matches in practice.
+  static constexpr std::size_t kMaxFree = 8;
+  std::array<pcre2_match_data*, kMaxFree> free_{};
+  std::size_t numFree_{0};
+};
+
+thread_local MatchDataPool tMatchDataPool;
+
+/// Number of ovector pairs required to match a pattern.
+std::uint32_t ovectorPairsForPattern(const pcre2_code* code) {
+  std::uint32_t captureCount = 0;
+  pcre2_pattern_info(code, PCRE2_INFO_CAPTURECOUNT, &captureCount);
+  // Plus one for the whole match.
+  return captureCount + 1;
+}
+
 Str errorCodeToMessage(const int errorCode) {
   Str errorMessage(kErrorMessageMaxLength, '\0');
 
@@ -99,47 +164,85 @@ std::optional<Regex::Match> Regex::match(const std::string_view subject) const {
 
 Str Regex::substituteToReduceSize(const std::string_view& subject,
                                   const std::string_view& replacement) const {
+  Str result;
+  substituteAndAppendTo(subject, replacement, result, /* allowGrowth= */ false);
+  return result;
+}
+
+void Regex::substituteAndAppendTo(const std::string_view subject,
+                                  const std::string_view replacement, Str& appendTo) const {
+  substituteAndAppendTo(subject, replacement, appendTo, /* allowGrowth= */ true);
+}
+
+void Regex::substituteAndAppendTo(const std::string_view subject,
+                                  const std::string_view replacement,
+                                  fmt::memory_buffer& appendTo) const {
+  substituteAndAppendTo(subject, replacement, appendTo, /* allowGrowth= */ true);
+}
+
+template <class Buffer>
+void Regex::substituteAndAppendTo(const std::string_view subject,
+                                  const std::string_view replacement, Buffer& appendTo,
+                                  const bool allowGrowth) const {
   if (subject.empty()) {
     // Zero-size buffer is immediately an error in pcre, so just short-circuit.
-    return {};
+    return;
   }
-  // `+ 1` so pcre knows it has enough space for a null terminator.
-  Str result(subject.size() + 1, '\0');
-  std::size_t resultSize = result.size();
 
   static_assert(sizeof(std::string_view::value_type) == sizeof(std::remove_pointer_t<PCRE2_SPTR8>),
                 "PCRE2 char type size mismatch");
-  static_assert(sizeof(Str::value_type) == sizeof(PCRE2_UCHAR8), "PCRE2 char type size mismatch");
+  static_assert(sizeof(typename Buffer::value_type) == sizeof(PCRE2_UCHAR8),
+                "PCRE2 char type size mismatch");
 
-  const int numSubstitutions =
-      pcre2_substitute(code_, /* regex object */
-                              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-                       reinterpret_cast<PCRE2_SPTR8>(subject.data()), /* subject */
-                       subject.size(),                                /* length of subject */
-                       0,                         /* start at offset 0 in the subject */
-                       PCRE2_SUBSTITUTE_GLOBAL,   /* substitute all matches */
-                       Match{code_}.data().get(), /* block for storing the result */
-                       nullptr,                   /* use default match context */
-                       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-                       reinterpret_cast<PCRE2_SPTR8>(replacement.data()), /* replacement */
-                       replacement.size(),                                /* replacement length */
-                       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-                       reinterpret_cast<PCRE2_UCHAR8*>(result.data()), /* output buffer */
-                       &resultSize                                     /* output buffer size */
-      );
+  const std::size_t offset = appendTo.size();
+  // `+ 1` so pcre knows it has enough space for a null terminator.
+  std::size_t resultSize = subject.size() + 1;
+  // Re-used for a retry, if the first attempt overflows.
+  const Match match{code_};
+
+  const auto substitute = [&] {
+    appendTo.resize(offset + resultSize);
+    return pcre2_substitute(
+        code_, /* regex object */
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        reinterpret_cast<PCRE2_SPTR8>(subject.data()), /* subject */
+        subject.size(),                                /* length of subject */
+        0,                                             /* start at offset 0 in the subject */
+        /* substitute all matches, and on overflow compute the required size */
+        PCRE2_SUBSTITUTE_GLOBAL | (allowGrowth ? PCRE2_SUBSTITUTE_OVERFLOW_LENGTH : 0U),
+        match.data().get(), /* block for storing the result */
+        nullptr,            /* use default match context */
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        reinterpret_cast<PCRE2_SPTR8>(replacement.data()), /* replacement */
+        replacement.size(),                                /* replacement length */
+        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast,*-pro-bounds-pointer-arithmetic)
+        reinterpret_cast<PCRE2_UCHAR8*>(appendTo.data() + offset), /* output buffer */
+        &resultSize                                                /* output buffer size */
+    );
+  };
+
+  int numSubstitutions = substitute();
+  if (numSubstitutions == PCRE2_ERROR_NOMEMORY && allowGrowth) {
+    // `resultSize` now holds the required size, including terminator.
+    numSubstitutions = substitute();
+  }
 
   if (numSubstitutions < 0) {
+    appendTo.resize(offset);
     throw errors::InputValidationException{
         fmt::format("Error {} substituting regex matches in '{}' with '{}': {}", numSubstitutions,
                     subject, replacement, errorCodeToMessage(numSubstitutions))};
   }
 
-  result.resize(resultSize);
-  return result;
+  appendTo.resize(offset + resultSize);
+}
+
+void Regex::Match::MatchDataDeleter::operator()(pcre2_match_data* ptr) const {
+  tMatchDataPool.release(ptr);
 }
 
 Regex::Match::Match(const pcre2_code_8* code)
-    : data_{pcre2_match_data_create_from_pattern(code, nullptr)} {
+    : data_{tMatchDataPool.acquire(ovectorPairsForPattern(code))} {
   if (!data_) {
     throw errors::InputValidationException{
         fmt::format("Failed to construct regex match data buffer")};
@@ -6,6 +6,8 @@
 #include <optional>
 #include <string_view>
 
+#include <fmt/format.h>
+
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 
@@ -21,8 +23,10 @@ namespace utils {
  *
  * Wraps PCRE2, using its JIT compilation and matching functions.
  *
- * Instances of this class are _not_ thread-safe. Use a separate
- * instance per thread.
+ * Instances of this class are thread-safe, i.e. a single instance can
+ * be used to match from multiple threads concurrently, without
+ * locking. Match data buffers are pooled per-thread, so matching does
+ * not usually allocate.
  *
  * As well as the regex object itself, matches are cached for subsequent
  * querying.
@@ -34,11 +38,22 @@ class Regex {
    */
   class Match {
     struct MatchDataDeleter {
-      void operator()(pcre2_match_data* ptr) { pcre2_match_data_free(ptr); }
+      /// Return the buffer to the current thread's pool.
+      void operator()(pcre2_match_data* ptr) const;
     };
     using Data = std::unique_ptr<pcre2_match_data, MatchDataDeleter>;
 
    public:
+    /**
+     * Constructor.
+     *
+     * Takes a match data buffer large enough for the given pattern
+     * from the current thread's pool, only allocating if none is
+     * available. The buffer is returned to the pool of the thread that
+     * destroys the match.
+     *
+     * @param code Compiled pattern.
+     */
     explicit Match(const pcre2_code* code);
 
     ~Match() = default;
@@ -124,7 +139,40 @@ class Regex {
   [[nodiscard]] Str substituteToReduceSize(const std::string_view& subject,
                                            const std::string_view& replacement) const;
 
+  /**
+   * Substitute all matches of the regex with the given replacement
+   * string, appending the result to an existing string.
+   *
+   * Unlike @ref substituteToReduceSize, the result may be longer than
+   * the subject string. Re-using a string across calls, combined with
+   * pooled match data, means substitution does not allocate once the
+   * string has sufficient capacity.
+   *
+   * @param subject String to copy, with substitutions.
+   * @param replacement Replacement to substitute matches with.
+   * @param appendTo String to append the result to.
+   * @throws InputValidationException On substitution error. The
+   * contents of @p appendTo are then unchanged.
+   */
+  void substituteAndAppendTo(std::string_view subject, std::string_view replacement,
+                             Str& appendTo) const;
+
+  /**
+   * Substitute all matches of the regex with the given replacement
+   * string, appending the result to a libfmt memory buffer.
+   *
+   * As for @ref substituteAndAppendTo(std::string_view,
+   * std::string_view, Str&) const, but appends to a buffer that may
+   * use inline (stack) storage for short results.
+   */
+  void substituteAndAppendTo(std::string_view subject, std::string_view replacement,
+                             fmt::memory_buffer& appendTo) const;
+
  private:
+  template <class Buffer>
+  void substituteAndAppendTo(std::string_view subject, std::string_view replacement,
+                             Buffer& appendTo, bool allowGrowth) const;
+
   pcre2_code* code_{nullptr};
 };
 }  // namespace utils
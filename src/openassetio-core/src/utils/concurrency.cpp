@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "concurrency.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+namespace {
+/// Period after which an idle worker thread exits.
+constexpr std::chrono::seconds kWorkerIdleTimeout{10};
+
+/**
+ * Pool of worker threads, shared by all invocations of
+ * invokeConcurrently.
+ *
+ * A worker is started whenever a task is queued and there is no idle
+ * worker to take it.
+ */
+class WorkerPool {
+ public:
+  /// A queued call. Must not throw.
+  using Task = std::function<void()>;
+
+  static WorkerPool& shared() {
+    // Deliberately leaked, since detached workers may still be waiting
+    // on it during static destruction.
+    static auto* const pool = new WorkerPool;
+    return *pool;
+  }
+
+  /**
+   * Queue a task, starting a worker if required.
+   *
+   * If a worker is required but cannot be started, the task is
+   * discarded, and so must be made by the caller instead.
+   */
+  void submit(Task task) {
+    std::unique_lock lock{mutex_};
+    tasks_.push_back(std::move(task));
+    if (numIdle_ >= tasks_.size()) {
+      lock.unlock();
+      taskQueued_.notify_one();
+      return;
+    }
+    try {
+      std::thread{[this] { runWorker(); }}.detach();
+    } catch (const std::system_error&) {
+      tasks_.pop_back();
+      return;
+    }
+    // The new worker is idle until it takes a task.
+    ++numIdle_;
+  }
+
+ private:
+  WorkerPool() = default;
+
+  void runWorker() {
+    std::unique_lock lock{mutex_};
+    while (taskQueued_.wait_for(lock, kWorkerIdleTimeout, [this] { return !tasks_.empty(); })) {
+      Task task = std::move(tasks_.front());
+      tasks_.pop_front();
+      --numIdle_;
+      lock.unlock();
+
+      task();
+      task = nullptr;
+
+      lock.lock();
+      ++numIdle_;
+    }
+    --numIdle_;
+  }
+
+  std::mutex mutex_;
+  std::condition_variable taskQueued_;
+  std::deque<Task> tasks_;
+  /// Workers waiting for, or about to wait for, a task.
+  std::size_t numIdle_{0};
+};
+
+/**
+ * State of a single invocation, shared with the tasks it queues, which
+ * may outlive it.
+ *
+ * Each call is claimed before it is made, by either a worker or the
+ * calling thread, so that it is made exactly once.
+ */
+struct Invocation {
+  Invocation(const std::size_t count, const std::function<void(std::size_t)>& workRef)
+      : claimed(count), exceptions(count), work{workRef}, numRemaining{count} {}
+
+  bool claim(const std::size_t idx) { return !claimed[idx].exchange(true); }
+
+  /// Make a claimed call.
+  void call(const std::size_t idx) {
+    try {
+      work(idx);
+    } catch (...) {
+      exceptions[idx] = std::current_exception();
+    }
+    const std::lock_guard lock{mutex};
+    if (--numRemaining == 0) {
+      done.notify_all();
+    }
+  }
+
+  std::vector<std::atomic<bool>> claimed;
+  std::vector<std::exception_ptr> exceptions;
+  /// Only valid whilst calls are outstanding.
+  const std::function<void(std::size_t)>& work;
+
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t numRemaining;
+};
+}  // namespace
+
+std::vector<std::exception_ptr> invokeConcurrently(const std::size_t count,
+                                                   const std::function<void(std::size_t)>& work,
+                                                   const std::size_t callerIdx) {
+  if (count < 2) {
+    std::vector<std::exception_ptr> exceptions(count);
+    if (count == 1) {
+      try {
+        work(0);
+      } catch (...) {
+        exceptions[0] = std::current_exception();
+      }
+    }
+    return exceptions;
+  }
+
+  const auto invocation = std::make_shared<Invocation>(count, work);
+  invocation->claim(callerIdx);
+
+  try {
+    WorkerPool& pool = WorkerPool::shared();
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      if (idx != callerIdx) {
+        pool.submit([invocation, idx] {
+          if (invocation->claim(idx)) {
+            invocation->call(idx);
+          }
+        });
+      }
+    }
+  } catch (...) {  // NOLINT(bugprone-empty-catch)
+    // Calls that could not be queued are made below.
+  }
+
+  invocation->call(callerIdx);
+
+  // Make any calls that workers have not yet started.
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (invocation->claim(idx)) {
+      invocation->call(idx);
+    }
+  }
+
+  std::unique_lock lock{invocation->mutex};
+  invocation->done.wait(lock, [&] { return invocation->numRemaining == 0; });
+  return std::move(invocation->exceptions);
+}
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+
+/**
+ * Call `work(idx)` for each `idx` in `[0, count)`, concurrently.
+ *
+ * The call for `callerIdx` is made on the calling thread. The others
+ * are queued to a pool of worker threads that is shared by all
+ * invocations, so threads are not created per invocation. The pool is
+ * started lazily and grows such that every queued call has a worker,
+ * and workers exit once idle for a while.
+ *
+ * Once its own call is complete, the calling thread makes any of the
+ * other calls that no worker has yet started. So all calls are made
+ * even if no worker thread could be started, and invocations can be
+ * nested, e.g. from within `work`, without risk of exhausting the
+ * pool.
+ *
+ * If `count` is one, no threads are involved. All calls are allowed to
+ * complete before returning, regardless of whether any throw.
+ *
+ * @param count Number of calls to make.
+ *
+ * @param work Callable taking the index of the call.
+ *
+ * @param callerIdx Index of the call to make on the calling thread.
+ * Must be less than `count`, unless `count` is zero.
+ *
+ * @return Exception thrown by each call, if any, in index order.
+ */
+std::vector<std::exception_ptr> invokeConcurrently(
+    std::size_t count, const std::function<void(std::size_t)>& work, std::size_t callerIdx = 0);
+
+/**
+ * Re-throw the first non-null exception, if any.
+ *
+ * @param exceptions Exceptions, e.g. from @ref invokeConcurrently.
+ */
+inline void rethrowFirst(const std::vector<std::exception_ptr>& exceptions) {
+  for (const auto& exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
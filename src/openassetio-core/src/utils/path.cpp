@@ -2,14 +2,17 @@
 // Copyright 2024-2025 The Foundry Visionmongers Ltd
 #include <openassetio/utils/path.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/typedefs.hpp>
 
 #include "./path/common.hpp"
+#include "./path/conversionCache.hpp"
 #include "./path/posix.hpp"
 #include "./path/posix/detail.hpp"
 #include "./path/windows.hpp"
@@ -71,16 +74,20 @@ struct FileUrlPathConverterImpl {
   // Entry point for converting POSIX path<->URL.
   path::posix::FileUrlPathConverter posixFileUrlPathConverter{posixUrlHandler, posixPathHandler};
 
+  // Cache of conversion results, if enabled.
+  std::unique_ptr<path::ConversionCache> cache;
+
   /**
    * Validate a path and construct a file URL from it.
    *
    * @param path Path string.
    * @param pathType Platform associated with path.
-   * @return Converted file URL.
+   * @param appendTo String to append the converted file URL to.
    * @throws InputValidationException if the path is invalid or
    * unsupported.
    */
-  [[nodiscard]] Str pathToUrl(const std::string_view path, PathType pathType) const {
+  void pathToUrlAndAppendTo(const std::string_view path, PathType pathType,
+                            Str& appendTo) const {
     if (path.empty()) {
       throw errors::InputValidationException(Str{path::kErrorEmptyPath});
     }
@@ -91,8 +98,14 @@ struct FileUrlPathConverterImpl {
 
     pathType = path::GenericPath::resolveSystemPathType(pathType);
 
-    return pathType == PathType::kWindows ? windowsFileUrlPathConverter.pathToUrl(path)
-                                          : posixFileUrlPathConverter.pathToUrl(path);
+    cachedAndAppendTo(path::ConversionCache::Direction::kPathToUrl, pathType, path, appendTo,
+                      [&] {
+                        if (pathType == PathType::kWindows) {
+                          windowsFileUrlPathConverter.pathToUrlAndAppendTo(path, appendTo);
+                        } else {
+                          posixFileUrlPathConverter.pathToUrlAndAppendTo(path, appendTo);
+                        }
+                      });
   }
 
   /**
@@ -100,33 +113,105 @@ struct FileUrlPathConverterImpl {
    *
    * @param fileUrl URL to convert.
    * @param pathType Platform associated with path.
-   * @return Platform-specific path string.
+   * @param appendTo String to append the platform-specific path to.
    * @throws InputValidationException if the URL or path that it decodes
    * to is invalid or unsupported.
    */
-  [[nodiscard]] Str pathFromUrl(const std::string_view fileUrl, PathType pathType) const {
+  void pathFromUrlAndAppendTo(const std::string_view fileUrl, PathType pathType,
+                              Str& appendTo) const {
     if (!urlHandler.isFileUrl(fileUrl)) {
       path::throwError(path::kErrorNotAFileUrl, fileUrl);
     }
     pathType = path::GenericPath::resolveSystemPathType(pathType);
-    return pathType == PathType::kWindows ? windowsFileUrlPathConverter.pathFromUrl(fileUrl)
-                                          : posixFileUrlPathConverter.pathFromUrl(fileUrl);
+    cachedAndAppendTo(path::ConversionCache::Direction::kPathFromUrl, pathType, fileUrl, appendTo,
+                      [&] {
+                        if (pathType == PathType::kWindows) {
+                          windowsFileUrlPathConverter.pathFromUrlAndAppendTo(fileUrl, appendTo);
+                        } else {
+                          posixFileUrlPathConverter.pathFromUrlAndAppendTo(fileUrl, appendTo);
+                        }
+                      });
+  }
+
+  /**
+   * Append a conversion result from the cache, if enabled, otherwise
+   * compute it and add it to the cache.
+   *
+   * @param direction Direction of conversion.
+   * @param pathType Resolved platform associated with path.
+   * @param input Path or URL to convert.
+   * @param appendTo String to append the converted path or URL to.
+   * @param convertAndAppendTo Function to compute the conversion,
+   * appending it to @p appendTo.
+   */
+  template <class Fn>
+  void cachedAndAppendTo(const path::ConversionCache::Direction direction,
+                         const PathType pathType, const std::string_view input, Str& appendTo,
+                         const Fn& convertAndAppendTo) const {
+    if (!cache) {
+      convertAndAppendTo();
+      return;
+    }
+    if (cache->findAndAppendTo(direction, pathType, input, appendTo)) {
+      return;
+    }
+    const std::size_t start = appendTo.size();
+    convertAndAppendTo();
+    cache->insert(direction, pathType, input, appendTo.substr(start));
   }
 };
 
 FileUrlPathConverter::FileUrlPathConverter()
     : impl_{std::make_unique<FileUrlPathConverterImpl>()} {}
 
+FileUrlPathConverter::FileUrlPathConverter(const std::size_t cacheCapacity)
+    : FileUrlPathConverter{} {
+  if (cacheCapacity > 0) {
+    impl_->cache = std::make_unique<path::ConversionCache>(cacheCapacity);
+  }
+}
+
 FileUrlPathConverter::~FileUrlPathConverter() = default;
 
 Str FileUrlPathConverter::pathToUrl(const std::string_view absolutePath,
                                     const PathType pathType) const {
-  return impl_->pathToUrl(absolutePath, pathType);
+  Str fileUrl;
+  impl_->pathToUrlAndAppendTo(absolutePath, pathType, fileUrl);
+  return fileUrl;
 }
 
 Str FileUrlPathConverter::pathFromUrl(const std::string_view fileUrl,
                                       const PathType pathType) const {
-  return impl_->pathFromUrl(fileUrl, pathType);
+  Str path;
+  impl_->pathFromUrlAndAppendTo(fileUrl, pathType, path);
+  return path;
+}
+
+void FileUrlPathConverter::pathToUrl(const std::vector<std::string_view>& absolutePaths,
+                                     std::vector<Str>& fileUrls, const PathType pathType) const {
+  fileUrls.resize(absolutePaths.size());
+  for (std::size_t idx = 0; idx < absolutePaths.size(); ++idx) {
+    // Convert in place, re-using the existing element's capacity.
+    fileUrls[idx].clear();
+    impl_->pathToUrlAndAppendTo(absolutePaths[idx], pathType, fileUrls[idx]);
+  }
+}
+
+void FileUrlPathConverter::pathFromUrl(const std::vector<std::string_view>& fileUrls,
+                                       std::vector<Str>& paths, const PathType pathType) const {
+  paths.resize(fileUrls.size());
+  for (std::size_t idx = 0; idx < fileUrls.size(); ++idx) {
+    // Convert in place, re-using the existing element's capacity.
+    paths[idx].clear();
+    impl_->pathFromUrlAndAppendTo(fileUrls[idx], pathType, paths[idx]);
+  }
+}
+
+FileUrlPathConverter::CacheStatistics FileUrlPathConverter::cacheStatistics() const {
+  if (!impl_->cache) {
+    return {0, 0, 0, 0};
+  }
+  return impl_->cache->statistics();
 }
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -27,10 +27,18 @@ Str ForwardSlashSeparatedString::removeTrailingForwardSlashesInPathSegments(
   return trailingForwardSlashesInSegmentRegex.substituteToReduceSize(str, "/");
 }
 
+void ForwardSlashSeparatedString::removeTrailingForwardSlashesInPathSegmentsAndAppendTo(
+    const std::string_view& str, Str& appendTo) const {
+  trailingForwardSlashesInSegmentRegex.substituteAndAppendTo(str, "/", appendTo);
+}
+
 // ---------------------------------------------------------------------
 // GenericUrl
 
 bool GenericUrl::isFileUrl(const std::string_view& url) const {
+  if (url.substr(0, kFileUrlPrefix.size()) == kFileUrlPrefix) {
+    return true;
+  }
   return fileUrlRegex.match(url).has_value();
 }
 
@@ -56,6 +56,7 @@ constexpr char kForwardSlash = '/';
 constexpr char kBackSlash = '\\';
 constexpr std::string_view kBackSlashStr = "\\";
 constexpr std::string_view kDoubleBackSlash = R"(\\)";
+constexpr std::string_view kFileUrlPrefix = "file://";
 
 /**
  * Throw an exception formatted to contain the problematic string.
@@ -82,6 +83,16 @@ struct ForwardSlashSeparatedString {
    * @return New string with `/`s collapsed.
    */
   [[nodiscard]] Str removeTrailingForwardSlashesInPathSegments(const std::string_view& str) const;
+
+  /**
+   * Replace multiple `/`s between segments with a single `/`,
+   * appending the result to an existing string.
+   *
+   * @param str Path or URL to process.
+   * @param appendTo String to append the result to.
+   */
+  void removeTrailingForwardSlashesInPathSegmentsAndAppendTo(const std::string_view& str,
+                                                             Str& appendTo) const;
 };
 
 /**
@@ -125,7 +136,8 @@ struct GenericUrl {
   /**
    * Check if URL has a `file://` scheme.
    *
-   * Regex (ab)used for case-insensitive matching.
+   * The common case of a lowercase scheme is checked directly, with a
+   * regex (ab)used for case-insensitive matching otherwise.
    *
    * @param url URL to check.
    * @return true if URL has file scheme, false otherwise.
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "conversionCache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <utility>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/path.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils::path {
+namespace {
+/// Upper limit on the number of independently locked shards.
+constexpr std::size_t kMaxShards = 16;
+/// Avoid tiny shards, where eviction approximates LRU poorly.
+constexpr std::size_t kMinShardCapacity = 64;
+}  // namespace
+
+ConversionCache::ConversionCache(const std::size_t capacity)
+    : capacity_{capacity},
+      numShards_{std::clamp<std::size_t>(capacity / kMinShardCapacity, 1, kMaxShards)},
+      shards_{std::make_unique<Shard[]>(numShards_)} {  // NOLINT(*-avoid-c-arrays)
+  assert(capacity > 0);
+  for (std::size_t idx = 0; idx < numShards_; ++idx) {
+    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+    Shard& shard = shards_[idx];
+    // Distribute any remainder over the first few shards.
+    shard.capacity = capacity / numShards_ + (idx < capacity % numShards_ ? 1 : 0);
+    shard.entries = std::make_unique<Entry[]>(shard.capacity);  // NOLINT(*-avoid-c-arrays)
+    shard.index.reserve(shard.capacity);
+  }
+}
+
+ConversionCache::~ConversionCache() = default;
+
+std::optional<Str> ConversionCache::find(const Direction direction, const PathType pathType,
+                                         const std::string_view input) const {
+  if (Str output; findAndAppendTo(direction, pathType, input, output)) {
+    return output;
+  }
+  return std::nullopt;
+}
+
+bool ConversionCache::findAndAppendTo(const Direction direction, const PathType pathType,
+                                      const std::string_view input, Str& appendTo) const {
+  const Key key = makeKey(direction, pathType, input);
+  const Shard& shard = shardFor(key);
+  {
+    const std::shared_lock lock{shard.mutex};
+    if (const auto iter = shard.index.find(key); iter != shard.index.end()) {
+      // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+      const Entry& entry = shard.entries[iter->second];
+      entry.referenced.store(true, std::memory_order_relaxed);
+      numHits_.fetch_add(1, std::memory_order_relaxed);
+      appendTo += entry.output;
+      return true;
+    }
+  }
+  numMisses_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void ConversionCache::insert(const Direction direction, const PathType pathType,
+                             const std::string_view input, Str output) {
+  const Key key = makeKey(direction, pathType, input);
+  Shard& shard = shardFor(key);
+  const std::unique_lock lock{shard.mutex};
+
+  if (shard.index.count(key) > 0) {
+    return;
+  }
+
+  std::size_t slot = shard.size;
+  if (shard.size < shard.capacity) {
+    ++shard.size;
+  } else {
+    // Sweep the hand round, giving recently used entries a second
+    // chance, until an unused entry is found. Terminates within two
+    // revolutions, since flags are cleared as we go.
+    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+    while (shard.entries[shard.hand].referenced.exchange(false, std::memory_order_relaxed)) {
+      shard.hand = (shard.hand + 1) % shard.capacity;
+    }
+    slot = shard.hand;
+    shard.hand = (shard.hand + 1) % shard.capacity;
+    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+    const Entry& evicted = shard.entries[slot];
+    // Must erase before overwriting the entry's input, which the key
+    // views.
+    shard.index.erase(Key{evicted.input, evicted.tag});
+  }
+
+  // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+  Entry& entry = shard.entries[slot];
+  entry.input = input;
+  entry.tag = key.tag;
+  entry.output = std::move(output);
+  entry.referenced.store(false, std::memory_order_relaxed);
+  shard.index.emplace(Key{entry.input, entry.tag}, slot);
+}
+
+FileUrlPathConverter::CacheStatistics ConversionCache::statistics() const {
+  std::size_t size = 0;
+  for (std::size_t idx = 0; idx < numShards_; ++idx) {
+    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+    const Shard& shard = shards_[idx];
+    const std::shared_lock lock{shard.mutex};
+    size += shard.size;
+  }
+  return {numHits_.load(std::memory_order_relaxed), numMisses_.load(std::memory_order_relaxed),
+          size, capacity_};
+}
+
+ConversionCache::Key ConversionCache::makeKey(const Direction direction, const PathType pathType,
+                                              const std::string_view input) {
+  assert(pathType != PathType::kSystem);
+  constexpr std::uint8_t kNumPathTypes = 3;
+  return {input, static_cast<std::uint8_t>(static_cast<std::uint8_t>(direction) * kNumPathTypes +
+                                           static_cast<std::uint8_t>(pathType))};
+}
+
+const ConversionCache::Shard& ConversionCache::shardFor(const Key& key) const {
+  // Use high bits, since the map within the shard uses the low bits.
+  constexpr std::size_t kShift = sizeof(std::size_t) * 8 / 2;
+  // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+  return shards_[(KeyHash{}(key) >> kShift) % numShards_];
+}
+
+ConversionCache::Shard& ConversionCache::shardFor(const Key& key) {
+  return const_cast<Shard&>(std::as_const(*this).shardFor(key));
+}
+}  // namespace utils::path
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/path.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils::path {
+/**
+ * Bounded, thread-safe cache of path/URL conversion results.
+ *
+ * Uses the CLOCK approximation of LRU eviction: a hit just flags the
+ * entry as recently used, and eviction sweeps a "hand" round the
+ * entries, clearing flags, until it finds one that isn't flagged. This
+ * means lookups only need a shared (read) lock.
+ *
+ * To reduce lock contention further, entries are partitioned into
+ * independently locked shards, by hash of the key.
+ *
+ * Only successful conversions should be cached, i.e. errors are
+ * re-computed (and re-thrown) each time.
+ */
+class ConversionCache {
+ public:
+  /// Direction of conversion, forming part of the cache key.
+  enum class Direction : std::uint8_t { kPathToUrl = 0, kPathFromUrl };
+
+  /**
+   * Constructor.
+   *
+   * @param capacity Maximum number of cached conversions. Must be
+   * greater than zero.
+   */
+  explicit ConversionCache(std::size_t capacity);
+  ~ConversionCache();
+  ConversionCache(const ConversionCache&) = delete;
+  ConversionCache(ConversionCache&&) noexcept = delete;
+  ConversionCache& operator=(const ConversionCache&) = delete;
+  ConversionCache& operator=(ConversionCache&&) noexcept = delete;
+
+  /**
+   * Look up a previous conversion, updating the hit/miss counters.
+   *
+   * @param direction Direction of conversion.
+   * @param pathType Resolved (i.e. not `kSystem`) path type.
+   * @param input Path or URL to look up.
+   * @return Cached result of the conversion, if available.
+   */
+  [[nodiscard]] std::optional<Str> find(Direction direction, PathType pathType,
+                                        std::string_view input) const;
+
+  /**
+   * Look up a previous conversion, appending it to an existing string,
+   * updating the hit/miss counters.
+   *
+   * @param direction Direction of conversion.
+   * @param pathType Resolved (i.e. not `kSystem`) path type.
+   * @param input Path or URL to look up.
+   * @param appendTo String to append the cached result to.
+   * @return Whether the conversion was cached.
+   */
+  bool findAndAppendTo(Direction direction, PathType pathType, std::string_view input,
+                       Str& appendTo) const;
+
+  /**
+   * Add a conversion to the cache, evicting an entry if full.
+   *
+   * If the input is already cached (e.g. added concurrently by another
+   * thread), the existing entry is kept.
+   *
+   * @param direction Direction of conversion.
+   * @param pathType Resolved (i.e. not `kSystem`) path type.
+   * @param input Path or URL that was converted.
+   * @param output Result of conversion.
+   */
+  void insert(Direction direction, PathType pathType, std::string_view input, Str output);
+
+  /// Snapshot of cache usage.
+  [[nodiscard]] FileUrlPathConverter::CacheStatistics statistics() const;
+
+ private:
+  /// Cache key, viewing the input stored in an entry (or the caller's
+  /// input for lookups).
+  struct Key {
+    std::string_view input;
+    std::uint8_t tag;
+    bool operator==(const Key& other) const {
+      return tag == other.tag && input == other.input;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      return std::hash<std::string_view>{}(key.input) ^ key.tag;
+    }
+  };
+
+  struct Entry {
+    Str input;
+    std::uint8_t tag{0};
+    Str output;
+    /// CLOCK "recently used" flag, set under a shared lock.
+    mutable std::atomic<bool> referenced{false};
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    /// Fixed-size storage, so keys viewing entries remain valid.
+    std::unique_ptr<Entry[]> entries;  // NOLINT(*-avoid-c-arrays)
+    std::size_t capacity{0};
+    std::size_t size{0};
+    /// CLOCK hand, i.e. next eviction candidate.
+    std::size_t hand{0};
+    std::unordered_map<Key, std::size_t, KeyHash> index;
+  };
+
+  static Key makeKey(Direction direction, PathType pathType, std::string_view input);
+  [[nodiscard]] const Shard& shardFor(const Key& key) const;
+  Shard& shardFor(const Key& key);
+
+  std::size_t capacity_;
+  std::size_t numShards_;
+  std::unique_ptr<Shard[]> shards_;  // NOLINT(*-avoid-c-arrays)
+  mutable std::atomic<std::size_t> numHits_{0};
+  mutable std::atomic<std::size_t> numMisses_{0};
+};
+}  // namespace utils::path
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "percentEncoding.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define OPENASSETIO_PATH_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__)
+// GCC and Clang allow compiling individual functions for AVX2, which
+// can then be selected at runtime.
+#define OPENASSETIO_PATH_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils::path::percentEncoding {
+namespace {
+constexpr char kPercent = '%';
+constexpr std::uint8_t kByteSize = 8;
+
+/// `%XX` for every byte value, as in Ada.
+constexpr auto kHexEscapes = [] {
+  constexpr std::string_view kHexDigits = "0123456789ABCDEF";
+  constexpr std::size_t kNibbleBits = 4;
+  constexpr std::uint8_t kNibbleMask = 0xF;
+  std::array<std::array<char, 3>, 256> escapes{};
+  for (std::size_t byte = 0; byte < escapes.size(); ++byte) {
+    escapes[byte] = {kPercent, kHexDigits[byte >> kNibbleBits], kHexDigits[byte & kNibbleMask]};
+  }
+  return escapes;
+}();
+
+/**
+ * Bytes classified as safe by the vectorised kernels, i.e.
+ * `[-./0-9A-Za-z_]`.
+ *
+ * Kernels can only be used if none of these are in the character set
+ * to encode. Other bytes fall back to a lookup in the character set.
+ */
+constexpr CharacterSet kSimdSafeCharacters = [] {
+  CharacterSet charSet{};
+  const auto add = [&](const char first, const char last) {
+    for (auto chr = static_cast<std::uint8_t>(first); chr <= static_cast<std::uint8_t>(last);
+         ++chr) {
+      charSet[chr / kByteSize] |= static_cast<std::uint8_t>(1 << (chr % kByteSize));
+    }
+  };
+  add('-', '9');
+  add('A', 'Z');
+  add('a', 'z');
+  add('_', '_');
+  return charSet;
+}();
+
+constexpr bool isInCharacterSet(const CharacterSet& charSet, const char chr) {
+  const auto byte = static_cast<std::uint8_t>(chr);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+  return (charSet[byte / kByteSize] & (1 << (byte % kByteSize))) != 0;
+}
+
+constexpr bool isHexDigit(const char chr) {
+  return (chr >= '0' && chr <= '9') || (chr >= 'a' && chr <= 'f') || (chr >= 'A' && chr <= 'F');
+}
+
+constexpr unsigned hexDigitValue(const char chr) {
+  constexpr unsigned kAlphaOffset = 10;
+  if (chr >= '0' && chr <= '9') {
+    return static_cast<unsigned>(chr - '0');
+  }
+  if (chr >= 'a' && chr <= 'f') {
+    return static_cast<unsigned>(chr - 'a') + kAlphaOffset;
+  }
+  return static_cast<unsigned>(chr - 'A') + kAlphaOffset;
+}
+
+bool isDisjointFromSimdSafeCharacters(const CharacterSet& charSet) {
+  for (std::size_t idx = 0; idx < charSet.size(); ++idx) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    if ((charSet[idx] & kSimdSafeCharacters[idx]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------
+// Kernels.
+//
+// Each returns the offset of the first byte from `pos` that needs
+// (un)escaping, or `input.size()` if there is none.
+
+std::size_t findEncodeScalar(const std::string_view input, std::size_t pos,
+                             const CharacterSet& charSet) {
+  for (; pos < input.size(); ++pos) {
+    if (isInCharacterSet(charSet, input[pos])) {
+      return pos;
+    }
+  }
+  return pos;
+}
+
+std::size_t findDecodeScalar(const std::string_view input, const std::size_t pos) {
+  const std::size_t found = input.find(kPercent, pos);
+  return found == std::string_view::npos ? input.size() : found;
+}
+
+#ifdef OPENASSETIO_PATH_SSE2
+constexpr std::size_t kSSE2Width = 16;
+
+/// Index of the lowest set bit. `value` must be non-zero.
+inline std::size_t countTrailingZeros(const unsigned value) {
+#if defined(_MSC_VER)
+  unsigned long idx = 0;  // NOLINT(google-runtime-int)
+  _BitScanForward(&idx, value);
+  return idx;
+#else
+  return static_cast<std::size_t>(__builtin_ctz(value));
+#endif
+}
+
+/// Mask of bytes in `[lo, hi]`, where `lo` and `hi` are ASCII.
+inline __m128i inRange(const __m128i bytes, const char low, const char high) {
+  // Bytes >= 0x80 are negative so compare as out of range.
+  return _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(static_cast<char>(low - 1))),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(high + 1)), bytes));
+}
+
+std::size_t findEncodeSSE2(const std::string_view input, std::size_t pos,
+                           const CharacterSet& charSet) {
+  constexpr int kAllSafe = 0xFFFF;
+  while (pos + kSSE2Width <= input.size()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+    const __m128i safe = _mm_or_si128(
+        _mm_or_si128(inRange(bytes, '-', '9'), inRange(bytes, 'A', 'Z')),
+        _mm_or_si128(inRange(bytes, 'a', 'z'), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_'))));
+    const int mask = _mm_movemask_epi8(safe);
+    if (mask == kAllSafe) {
+      pos += kSSE2Width;
+      continue;
+    }
+    // Skip to the first byte not known to be safe, and check it.
+    pos += countTrailingZeros(static_cast<unsigned>(~mask));
+    if (isInCharacterSet(charSet, input[pos])) {
+      return pos;
+    }
+    ++pos;
+  }
+  return findEncodeScalar(input, pos, charSet);
+}
+
+std::size_t findDecodeSSE2(const std::string_view input, std::size_t pos) {
+  const __m128i percent = _mm_set1_epi8(kPercent);
+  while (pos + kSSE2Width <= input.size()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+    if (const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, percent)); mask != 0) {
+      return pos + countTrailingZeros(static_cast<unsigned>(mask));
+    }
+    pos += kSSE2Width;
+  }
+  return findDecodeScalar(input, pos);
+}
+#endif
+
+#ifdef OPENASSETIO_PATH_AVX2
+constexpr std::size_t kAVX2Width = 32;
+
+__attribute__((target("avx2"))) inline __m256i inRange256(const __m256i bytes, const char low,
+                                                          const char high) {
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(static_cast<char>(low - 1))),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(high + 1)), bytes));
+}
+
+__attribute__((target("avx2"))) std::size_t findEncodeAVX2(const std::string_view input,
+                                                           std::size_t pos,
+                                                           const CharacterSet& charSet) {
+  constexpr int kAllSafe = -1;  // All 32 bits set.
+  while (pos + kAVX2Width <= input.size()) {
+    const __m256i bytes =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+    const __m256i safe = _mm256_or_si256(
+        _mm256_or_si256(inRange256(bytes, '-', '9'), inRange256(bytes, 'A', 'Z')),
+        _mm256_or_si256(inRange256(bytes, 'a', 'z'),
+                        _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('_'))));
+    const int mask = _mm256_movemask_epi8(safe);
+    if (mask == kAllSafe) {
+      pos += kAVX2Width;
+      continue;
+    }
+    pos += countTrailingZeros(~static_cast<unsigned>(mask));
+    if (isInCharacterSet(charSet, input[pos])) {
+      return pos;
+    }
+    ++pos;
+  }
+  return findEncodeSSE2(input, pos, charSet);
+}
+
+__attribute__((target("avx2"))) std::size_t findDecodeAVX2(const std::string_view input,
+                                                           std::size_t pos) {
+  const __m256i percent = _mm256_set1_epi8(kPercent);
+  while (pos + kAVX2Width <= input.size()) {
+    const __m256i bytes =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+    if (const int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, percent)); mask != 0) {
+      return pos + countTrailingZeros(static_cast<unsigned>(mask));
+    }
+    pos += kAVX2Width;
+  }
+  return findDecodeSSE2(input, pos);
+}
+#endif
+
+std::size_t findEncode(const std::string_view input, const std::size_t pos,
+                       const CharacterSet& charSet, const SimdLevel simdLevel) {
+  switch (simdLevel) {
+#ifdef OPENASSETIO_PATH_AVX2
+    case SimdLevel::kAVX2:
+      return findEncodeAVX2(input, pos, charSet);
+#endif
+#ifdef OPENASSETIO_PATH_SSE2
+    case SimdLevel::kSSE2:
+      return findEncodeSSE2(input, pos, charSet);
+#endif
+    default:
+      return findEncodeScalar(input, pos, charSet);
+  }
+}
+
+std::size_t findDecode(const std::string_view input, const std::size_t pos,
+                       const SimdLevel simdLevel) {
+  switch (simdLevel) {
+#ifdef OPENASSETIO_PATH_AVX2
+    case SimdLevel::kAVX2:
+      return findDecodeAVX2(input, pos);
+#endif
+#ifdef OPENASSETIO_PATH_SSE2
+    case SimdLevel::kSSE2:
+      return findDecodeSSE2(input, pos);
+#endif
+    default:
+      return findDecodeScalar(input, pos);
+  }
+}
+}  // namespace
+
+SimdLevel supportedSimdLevel() {
+  static const SimdLevel kSupportedSimdLevel = [] {
+#ifdef OPENASSETIO_PATH_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::kAVX2;
+    }
+#endif
+#ifdef OPENASSETIO_PATH_SSE2
+    return SimdLevel::kSSE2;
+#else
+    return SimdLevel::kScalar;
+#endif
+  }();
+  return kSupportedSimdLevel;
+}
+
+bool percentEncodeAndAppendTo(const std::string_view input, const CharacterSet& charSet,
+                              Str& appendTo, SimdLevel simdLevel) {
+  if (!isDisjointFromSimdSafeCharacters(charSet)) {
+    simdLevel = SimdLevel::kScalar;
+  }
+
+  std::size_t pos = findEncode(input, 0, charSet, simdLevel);
+  if (pos == input.size()) {
+    return false;
+  }
+
+  // Worst case is every remaining byte being escaped.
+  constexpr std::size_t kEscapeSize = 3;
+  appendTo.reserve(appendTo.size() + pos + ((input.size() - pos) * kEscapeSize));
+  appendTo.append(input.data(), pos);
+
+  while (pos < input.size()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    const auto& escape = kHexEscapes[static_cast<std::uint8_t>(input[pos])];
+    appendTo.append(escape.data(), escape.size());
+    ++pos;
+    const std::size_t next = findEncode(input, pos, charSet, simdLevel);
+    appendTo.append(input.data() + pos, next - pos);
+    pos = next;
+  }
+  return true;
+}
+
+Str percentDecode(const std::string_view input, const SimdLevel simdLevel) {
+  std::size_t pos = findDecode(input, 0, simdLevel);
+  if (pos == input.size()) {
+    return Str{input};
+  }
+
+  Str decoded;
+  decoded.reserve(input.size());
+  decoded.append(input.data(), pos);
+
+  constexpr std::size_t kEscapeSize = 3;
+  constexpr unsigned kHighNibbleMultiplier = 16;
+  while (pos < input.size()) {
+    if (pos + kEscapeSize <= input.size() && isHexDigit(input[pos + 1]) &&
+        isHexDigit(input[pos + 2])) {
+      decoded += static_cast<char>((hexDigitValue(input[pos + 1]) * kHighNibbleMultiplier) +
+                                   hexDigitValue(input[pos + 2]));
+      pos += kEscapeSize;
+    } else {
+      // Invalid escape sequence, copy verbatim.
+      decoded += kPercent;
+      ++pos;
+    }
+    const std::size_t next = findDecode(input, pos, simdLevel);
+    decoded.append(input.data() + pos, next - pos);
+    pos = next;
+  }
+  return decoded;
+}
+}  // namespace utils::path::percentEncoding
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Vectorised percent-encoding and decoding of URL path components.
+ *
+ * These are drop-in replacements for Ada's `percent_encode` and
+ * `percent_decode`, producing identical output. Rather than processing
+ * one character at a time, 16 (SSE2) or 32 (AVX2) bytes are classified
+ * at once, and runs of bytes that need no (un)escaping are bulk-copied.
+ *
+ * The instruction set is chosen at runtime, based on CPU support. AVX2
+ * is only available when built with GCC or Clang. Other architectures
+ * use a scalar fallback.
+ */
+namespace utils::path::percentEncoding {
+
+/// Bitmap of bytes to percent-encode, as used by Ada.
+using CharacterSet = std::array<std::uint8_t, 32>;
+
+/// Instruction set used to process bytes.
+enum class SimdLevel : std::uint8_t { kScalar = 0, kSSE2, kAVX2 };
+
+/**
+ * Get the most capable instruction set supported by the running CPU.
+ *
+ * The result is computed once and cached.
+ */
+[[nodiscard]] SimdLevel supportedSimdLevel();
+
+/**
+ * Percent-encode a string, appending the result to another string.
+ *
+ * @param input String to encode.
+ * @param charSet Bytes to encode.
+ * @param appendTo String to append the encoded string to. Not modified
+ * if no encoding is needed.
+ * @param simdLevel Instruction set to use. Must not exceed @ref
+ * supportedSimdLevel.
+ * @return true if encoding was needed, false otherwise.
+ */
+bool percentEncodeAndAppendTo(std::string_view input, const CharacterSet& charSet, Str& appendTo,
+                              SimdLevel simdLevel = supportedSimdLevel());
+
+/**
+ * Percent-decode a string.
+ *
+ * Invalid escape sequences (i.e. `%` not followed by two hex digits)
+ * are copied verbatim.
+ *
+ * @param input String to decode.
+ * @param simdLevel Instruction set to use. Must not exceed @ref
+ * supportedSimdLevel.
+ * @return Decoded string.
+ */
+[[nodiscard]] Str percentDecode(std::string_view input,
+                                SimdLevel simdLevel = supportedSimdLevel());
+}  // namespace utils::path::percentEncoding
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -9,6 +9,7 @@
 #include <openassetio/typedefs.hpp>
 
 #include "common.hpp"
+#include "percentEncoding.hpp"
 #include "posix/detail.hpp"
 
 namespace openassetio {
@@ -16,6 +17,38 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils::path::posix {
 
 Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) const {
+  Str url;
+  pathToUrlAndAppendTo(posixPath, url);
+  return url;
+}
+
+Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+  Str posixPath;
+  pathFromUrlAndAppendTo(url, posixPath);
+  return posixPath;
+}
+
+void FileUrlPathConverter::pathToUrlAndAppendTo(const std::string_view& posixPath,
+                                                Str& appendTo) const {
+  if (detail::PosixPath::isSimpleAbsolutePath(posixPath)) {
+    appendTo.reserve(appendTo.size() + kFileUrlPrefix.size() + posixPath.size());
+    appendTo += kFileUrlPrefix;
+    appendTo += posixPath;
+    return;
+  }
+  appendTo += pathToUrlGeneral(posixPath);
+}
+
+void FileUrlPathConverter::pathFromUrlAndAppendTo(const std::string_view& url,
+                                                  Str& appendTo) const {
+  if (const auto simplePath = detail::PosixUrl::simplePath(url)) {
+    appendTo += *simplePath;
+    return;
+  }
+  appendTo += pathFromUrlGeneral(url);
+}
+
+Str FileUrlPathConverter::pathToUrlGeneral(const std::string_view& posixPath) const {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
   assert(!posixPath.empty());
@@ -47,7 +80,7 @@ Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) const {
   return adaUrl.get_href();
 }
 
-Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+Str FileUrlPathConverter::pathFromUrlGeneral(const std::string_view& url) const {
   ada::result<ada::url_aggregator> adaUrl = ada::parse(url);
   if (!adaUrl) {
     throwError(kErrorUrlParseFailure, url);
@@ -63,7 +96,7 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
     throwError(kErrorEncodedSeparator, url);
   }
 
-  const Str decodedPath = ada::unicode::percent_decode(path, path.find(kPercent));
+  const Str decodedPath = percentEncoding::percentDecode(path);
 
   if (GenericPath::containsNullByte(decodedPath)) {
     throwError(kErrorNullByte, url);
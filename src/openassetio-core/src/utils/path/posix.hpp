@@ -28,6 +28,9 @@ struct FileUrlPathConverter {
   /**
    * Convert a POSIX path into a file URL.
    *
+   * Simple paths (see detail::PosixPath::isSimpleAbsolutePath) are
+   * converted directly, otherwise falls back to @ref pathToUrlGeneral.
+   *
    * @param posixPath path to convert.
    * @return URL string.
    * @throws InputValidationException if the path is invalid (e.g.
@@ -38,12 +41,48 @@ struct FileUrlPathConverter {
   /**
    * Convert a file URL to a POSIX path.
    *
+   * URLs with simple paths (see detail::PosixUrl::simplePath) are
+   * converted directly, otherwise falls back to @ref
+   * pathFromUrlGeneral.
+   *
    * @param url URL to convert.
    * @return POSIX path.
    * @throws InputValidationException if the URL or path that it decodes
    * to is invalid or unsupported.
    */
   [[nodiscard]] Str pathFromUrl(const std::string_view& url) const;
+
+  /**
+   * Convert a POSIX path into a file URL, appending the result to an
+   * existing string.
+   *
+   * @see pathToUrl
+   */
+  void pathToUrlAndAppendTo(const std::string_view& posixPath, Str& appendTo) const;
+
+  /**
+   * Convert a file URL to a POSIX path, appending the result to an
+   * existing string.
+   *
+   * @see pathFromUrl
+   */
+  void pathFromUrlAndAppendTo(const std::string_view& url, Str& appendTo) const;
+
+  /**
+   * Convert any POSIX path into a file URL, using the general regex
+   * and URL parser based approach.
+   *
+   * @see pathToUrl
+   */
+  [[nodiscard]] Str pathToUrlGeneral(const std::string_view& posixPath) const;
+
+  /**
+   * Convert any file URL to a POSIX path, using the general regex and
+   * URL parser based approach.
+   *
+   * @see pathFromUrl
+   */
+  [[nodiscard]] Str pathFromUrlGeneral(const std::string_view& url) const;
 };
 }  // namespace utils::path::posix
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
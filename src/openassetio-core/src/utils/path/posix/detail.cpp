@@ -3,6 +3,7 @@
 #include "detail.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <optional>
 #include <string_view>
 
@@ -10,6 +11,7 @@
 #include <openassetio/typedefs.hpp>
 
 #include "../common.hpp"
+#include "../percentEncoding.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -29,6 +31,39 @@ bool PosixPath::startsWithForwardSlash(const std::string_view& path) {
   return path.front() == kForwardSlash;
 }
 
+bool PosixPath::isSimpleAbsolutePath(const std::string_view& path) {
+  if (path.empty() || path.front() != kForwardSlash) {
+    return false;
+  }
+
+  const auto isSimpleChar = [](const char chr) {
+    return (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') ||
+           (chr >= '0' && chr <= '9') || chr == kHyphen || chr == '.' || chr == '_' ||
+           chr == '~';
+  };
+
+  std::size_t segmentStart = 1;
+  bool isDotsOnlySegment = true;
+
+  for (std::size_t idx = 1; idx < path.size(); ++idx) {
+    const char chr = path[idx];
+    if (chr == kForwardSlash) {
+      // Empty (i.e. `//`) or `.`/`..` segment.
+      if (idx == segmentStart || isDotsOnlySegment) {
+        return false;
+      }
+      segmentStart = idx + 1;
+      isDotsOnlySegment = true;
+    } else if (!isSimpleChar(chr)) {
+      return false;
+    } else if (chr != '.') {
+      isDotsOnlySegment = false;
+    }
+  }
+  // Final segment may be empty (trailing `/`), but not `.`/`..`.
+  return segmentStart == path.size() || !isDotsOnlySegment;
+}
+
 Str PosixPath::removeTrailingForwardSlashesInPathSegments(const std::string_view& path) const {
   if (path.size() <= 2) {
     return Str{path};
@@ -41,12 +76,11 @@ Str PosixPath::removeTrailingForwardSlashesInPathSegments(const std::string_view
   if (path[0] == kForwardSlash && path[1] == kForwardSlash && path[2] != kForwardSlash) {
     const std::string_view pathView{path};
     normalisedPath += pathView.substr(0, 2);
-    normalisedPath +=
-        forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(
-            pathView.substr(2));
+    forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegmentsAndAppendTo(
+        pathView.substr(2), normalisedPath);
   } else {
-    normalisedPath =
-        forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(path);
+    forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegmentsAndAppendTo(
+        path, normalisedPath);
   }
   return normalisedPath;
 }
@@ -63,11 +97,22 @@ std::optional<Str> PosixUrl::maybePercentEncode(const std::string_view& path) {
   // Ada will automatically %-encode upon setting the URL path, but
   // with a more limited set than we want.
   Str encodedPath;
-  if (ada::unicode::percent_encode<false>(path, kPercentEncodeCharacterSet.data(), encodedPath)) {
+  if (percentEncoding::percentEncodeAndAppendTo(path, kPercentEncodeCharacterSet, encodedPath)) {
     return encodedPath;
   }
   return std::nullopt;
 }
+
+std::optional<std::string_view> PosixUrl::simplePath(const std::string_view& url) {
+  if (url.substr(0, kFileUrlPrefix.size()) != kFileUrlPrefix) {
+    return std::nullopt;
+  }
+  const std::string_view path = url.substr(kFileUrlPrefix.size());
+  if (!PosixPath::isSimpleAbsolutePath(path)) {
+    return std::nullopt;
+  }
+  return path;
+}
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
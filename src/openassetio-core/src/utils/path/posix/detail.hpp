@@ -43,6 +43,25 @@ struct PosixPath {
    */
   [[nodiscard]] static bool startsWithForwardSlash(const std::string_view& path);
 
+  /**
+   * Check if a path is a simple absolute path, that needs no
+   * validation, encoding or normalisation to be converted to a URL
+   * path, and vice versa.
+   *
+   * That is, a path starting with `/` and consisting only of
+   * alphanumerics, `-`, `.`, `_`, `~` and `/`, with no empty (`//`),
+   * `.` or `..` segments, other than an empty final segment (i.e. a
+   * trailing `/`).
+   *
+   * This is a single-pass scan, and allows the common case to bypass
+   * the (comparatively expensive) regex and URL parser based
+   * conversion.
+   *
+   * @param path Path to check.
+   * @return true if the path is simple, false otherwise.
+   */
+  [[nodiscard]] static bool isSimpleAbsolutePath(const std::string_view& path);
+
   /**
    * Remove extraneous leading `/`s in a path.
    *
@@ -118,6 +137,18 @@ struct PosixUrl {
    * @return true if encoding was required, false otherwise.
    */
   static std::optional<Str> maybePercentEncode(const std::string_view& path);
+
+  /**
+   * Get the path component of a URL, if it is a `file://` URL with a
+   * lowercase scheme, no host, and a simple path.
+   *
+   * @see PosixPath::isSimpleAbsolutePath
+   *
+   * @param url URL to check.
+   * @return Path component of the URL, or empty if the URL is not
+   * simple.
+   */
+  [[nodiscard]] static std::optional<std::string_view> simplePath(const std::string_view& url);
 };
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <string_view>
 
 #include <ada.h>
@@ -12,6 +13,7 @@
 #include <openassetio/typedefs.hpp>
 
 #include "common.hpp"
+#include "percentEncoding.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -21,6 +23,19 @@ namespace utils::path::windows {
 // FileUrlPathConverter
 
 Str FileUrlPathConverter::pathToUrl(const std::string_view& windowsPath) const {
+  Str url;
+  pathToUrlAndAppendTo(windowsPath, url);
+  return url;
+}
+
+Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+  Str windowsPath;
+  pathFromUrlAndAppendTo(url, windowsPath);
+  return windowsPath;
+}
+
+void FileUrlPathConverter::pathToUrlAndAppendTo(const std::string_view& windowsPath,
+                                                Str& appendTo) const {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
   assert(!windowsPath.empty());
@@ -38,10 +53,11 @@ Str FileUrlPathConverter::pathToUrl(const std::string_view& windowsPath) const {
     }
   }
 
-  return url.get_href();
+  appendTo += url.get_href();
 }
 
-Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+void FileUrlPathConverter::pathFromUrlAndAppendTo(const std::string_view& url,
+                                                  Str& appendTo) const {
   ada::result<ada::url_aggregator> adaUrl = ada::parse(url);
   if (!adaUrl) {
     throwError(kErrorUrlParseFailure, url);
@@ -56,7 +72,7 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
     trimmedPath = encodedPath.substr(1);
   }
 
-  Str decodedPath = ada::unicode::percent_decode(trimmedPath, trimmedPath.find(kPercent));
+  const Str decodedPath = percentEncoding::percentDecode(trimmedPath);
 
   // Note: validation is ordered to match swift-url's implementation,
   // i.e. it satisfies the error priority of the test suite from the
@@ -75,29 +91,31 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
     throwError(kErrorUnsupportedHostname, url);
   }
 
-  Str windowsPath;
+  // Build the path in place at the end of the output string.
+  const std::size_t start = appendTo.size();
   if (!host.empty()) {
-    windowsPath += kDoubleBackSlash;
+    appendTo += kDoubleBackSlash;
     if (const auto ip6Host = urlHandler.ip6ToValidHostname(host)) {
-      windowsPath += *ip6Host;
+      appendTo += *ip6Host;
     } else {
-      windowsPath += host;
+      appendTo += host;
     }
   }
 
-  decodedPath =
-      forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(decodedPath);
-  windowsPath += decodedPath;
+  forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegmentsAndAppendTo(
+      decodedPath, appendTo);
 
-  std::replace(windowsPath.begin(), windowsPath.end(), kForwardSlash, kBackSlash);
+  const auto windowsPathBegin = appendTo.begin() + static_cast<std::ptrdiff_t>(start);
+  std::replace(windowsPathBegin, appendTo.end(), kForwardSlash, kBackSlash);
 
-  if (windowsPath.size() > kMaxPath) {
-    windowsPath = host.empty()
-                      ? pathTypes::UncUnnormalisedDeviceDrivePath::prefixDrivePath(windowsPath)
-                      : pathTypes::UncUnnormalisedDeviceSharePath::prefixUncSharePath(windowsPath);
+  if (const std::string_view windowsPath = std::string_view{appendTo}.substr(start);
+      windowsPath.size() > kMaxPath) {
+    Str prefixedPath =
+        host.empty() ? pathTypes::UncUnnormalisedDeviceDrivePath::prefixDrivePath(windowsPath)
+                     : pathTypes::UncUnnormalisedDeviceSharePath::prefixUncSharePath(windowsPath);
+    appendTo.resize(start);
+    appendTo += prefixedPath;
   }
-
-  return windowsPath;
 }
 }  // namespace utils::path::windows
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
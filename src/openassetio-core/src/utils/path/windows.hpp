@@ -68,6 +68,22 @@ struct FileUrlPathConverter {
    * invalid path.
    */
   [[nodiscard]] Str pathFromUrl(const std::string_view& url) const;
+
+  /**
+   * Convert a Windows path into a file URL, appending the result to an
+   * existing string.
+   *
+   * @see pathToUrl
+   */
+  void pathToUrlAndAppendTo(const std::string_view& windowsPath, Str& appendTo) const;
+
+  /**
+   * Convert a file URL to a Windows path, appending the result to an
+   * existing string.
+   *
+   * @see pathFromUrl
+   */
+  void pathFromUrlAndAppendTo(const std::string_view& url, Str& appendTo) const;
 };
 }  // namespace utils::path::windows
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -11,6 +11,7 @@
 #include <openassetio/typedefs.hpp>
 
 #include "../common.hpp"
+#include "../percentEncoding.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -39,16 +40,7 @@ std::optional<Str> WindowsUrl::ip6ToValidHostname(const std::string_view& host)
 bool WindowsUrl::maybePercentEncodeAndAppendTo(const std::string_view& path, Str& appendTo) {
   // Ada will automatically %-encode upon setting the URL path, but
   // with a more limited set than we want.
-  // Note: Cannot use `percent_encode<true>`, which appends to a given
-  // string only if encoding is needed. That specialisation is not
-  // generated in Ada on MacOS/clang and fails to link. Ada devs will
-  // not support it. See https://github.com/ada-url/ada/issues/580
-  if (Str result;
-      ada::unicode::percent_encode<false>(path, kPercentEncodeCharacterSet.data(), result)) {
-    appendTo += result;
-    return true;
-  }
-  return false;
+  return percentEncoding::percentEncodeAndAppendTo(path, kPercentEncodeCharacterSet, appendTo);
 }
 
 bool WindowsUrl::setUrlHost(const std::string_view& host, ada::url& url) const {
@@ -101,6 +93,11 @@ Str NormalisedPath::removeTrailingDotsInPathSegments(const std::string_view& pat
   return trailingSingleDotInSegmentRegex.substituteToReduceSize(path, "");
 }
 
+void NormalisedPath::removeTrailingDotsInPathSegmentsAndAppendTo(const std::string_view& path,
+                                                                 Str& appendTo) const {
+  trailingSingleDotInSegmentRegex.substituteAndAppendTo(path, "", appendTo);
+}
+
 Str NormalisedPath::removeTrailingSlashesInPathSegments(const std::string_view& path) const {
   return trailingSlashesInSegmentRegex.substituteToReduceSize(path, kBackSlashStr);
 }
@@ -215,6 +215,16 @@ struct NormalisedPath {
    */
   [[nodiscard]] Str removeTrailingDotsInPathSegments(const std::string_view& path) const;
 
+  /**
+   * Remove all trailing `.`s in each path segment, appending the
+   * result to an existing string.
+   *
+   * @param path Path to process.
+   * @param appendTo String to append the result to.
+   */
+  void removeTrailingDotsInPathSegmentsAndAppendTo(const std::string_view& path,
+                                                   Str& appendTo) const;
+
   /**
    * Remove all trailing slashes in each path segment.
    *
@@ -141,7 +141,8 @@ void UncSharePath::setUrlPath(const detail::UncDetails& uncDetails, ada::url& ur
   Str normalisedPath;
   normalisedPath.reserve(uncDetails.shareNameAndPath.size());
   normalisedPath += uncDetails.shareName;
-  normalisedPath += normalisedPathHandler.removeTrailingDotsInPathSegments(uncDetails.sharePath);
+  normalisedPathHandler.removeTrailingDotsInPathSegmentsAndAppendTo(uncDetails.sharePath,
+                                                                    normalisedPath);
   normalisedPath = normalisedPathHandler.removeTrailingSlashesInPathSegments(normalisedPath);
 
   if (Str encodedPath;
@@ -1,8 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <string_view>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 #include <fmt/args.h>
 #include <fmt/core.h>
@@ -17,6 +21,51 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils {
+namespace {
+[[noreturn]] void throwSubstitutionError(const std::string_view input,
+                                         const std::string_view reason) {
+  throw errors::InputValidationException{fmt::format(
+      "substitute(): failed to process the input string '{}': {}", input, reason)};
+}
+
+/// Check if a placeholder name is valid, as per libfmt.
+bool isIdentifier(const std::string_view name) {
+  const auto isAlpha = [](const char chr) {
+    return (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || chr == '_';
+  };
+  const auto isDigit = [](const char chr) { return chr >= '0' && chr <= '9'; };
+  return !name.empty() && isAlpha(name.front()) &&
+         std::all_of(name.begin() + 1, name.end(),
+                     [&](const char chr) { return isAlpha(chr) || isDigit(chr); });
+}
+
+/**
+ * Append a substitution value to a string.
+ *
+ * Values without a format specifier are appended directly, bypassing
+ * libfmt's format string parsing, but giving identical output.
+ */
+template <class T>
+void appendValue(const T& value, const Str& valueFormat, Str& result) {
+  if (valueFormat.empty()) {
+    if constexpr (std::is_same_v<T, Str>) {
+      result += value;
+    } else if constexpr (std::is_same_v<T, Bool>) {
+      result += value ? "true" : "false";
+    } else if constexpr (std::is_same_v<T, Int>) {
+      const fmt::format_int formatted{value};
+      result.append(formatted.data(), formatted.size());
+    } else {
+      fmt::format_to(std::back_inserter(result), "{}", value);
+    }
+  } else if constexpr (std::is_same_v<T, Str>) {
+    const std::string_view valueView{value};
+    fmt::vformat_to(std::back_inserter(result), valueFormat, fmt::make_format_args(valueView));
+  } else {
+    fmt::vformat_to(std::back_inserter(result), valueFormat, fmt::make_format_args(value));
+  }
+}
+}  // namespace
 
 Str substitute(const std::string_view input, const InfoDictionary& substitutions) {
   fmt::dynamic_format_arg_store<fmt::format_context> args;
@@ -42,8 +91,111 @@ Str substitute(const std::string_view input, const InfoDictionary& substitutions
   try {
     return vformat(input, args);
   } catch (const fmt::format_error& exc) {
-    throw errors::InputValidationException{fmt::format(
-        "substitute(): failed to process the input string '{}': {}", input, exc.what())};
+    throwSubstitutionError(input, exc.what());
+  }
+}
+
+CompiledSubstitution::CompiledSubstitution(const std::string_view input) : input_{input} {
+  Str literal;
+  const auto flushLiteral = [&] {
+    if (!literal.empty()) {
+      segments_.push_back({Segment::Kind::kLiteral, std::move(literal), {}});
+      literal.clear();
+    }
+  };
+
+  std::size_t pos = 0;
+  while (pos < input.size()) {
+    const char chr = input[pos];
+    const bool isEscaped = pos + 1 < input.size() && input[pos + 1] == chr;
+
+    if (chr == '}') {
+      if (!isEscaped) {
+        throwSubstitutionError(input, "unmatched '}' in format string");
+      }
+      literal += chr;
+      pos += 2;
+      continue;
+    }
+    if (chr != '{') {
+      literal += chr;
+      ++pos;
+      continue;
+    }
+    if (isEscaped) {
+      literal += chr;
+      pos += 2;
+      continue;
+    }
+
+    const std::size_t end = input.find('}', pos + 1);
+    if (end == std::string_view::npos) {
+      throwSubstitutionError(input, "invalid format string");
+    }
+    const std::string_view field = input.substr(pos + 1, end - pos - 1);
+    if (field.find('{') != std::string_view::npos) {
+      throwSubstitutionError(input, "nested placeholders are not supported");
+    }
+    const std::size_t colon = field.find(':');
+    const std::string_view key = field.substr(0, colon);
+    if (key.empty() || (key.front() >= '0' && key.front() <= '9')) {
+      throwSubstitutionError(input, "positional placeholders are not supported");
+    }
+    if (!isIdentifier(key)) {
+      throwSubstitutionError(input, "invalid format string");
+    }
+
+    Str valueFormat;
+    if (colon != std::string_view::npos && colon + 1 < field.size()) {
+      valueFormat = fmt::format("{{:{}}}", field.substr(colon + 1));
+    }
+
+    flushLiteral();
+    segments_.push_back({Segment::Kind::kPlaceholder, Str{key}, std::move(valueFormat)});
+    if (std::find(keys_.begin(), keys_.end(), key) == keys_.end()) {
+      keys_.emplace_back(key);
+    }
+    pos = end + 1;
+  }
+  flushLiteral();
+}
+
+Str CompiledSubstitution::render(const InfoDictionary& substitutions) const {
+  Str result;
+  renderTo(substitutions, result);
+  return result;
+}
+
+void CompiledSubstitution::render(const InfoDictionary& substitutions, Str& result) const {
+  result.clear();
+  renderTo(substitutions, result);
+}
+
+void CompiledSubstitution::render(const std::vector<InfoDictionary>& substitutionsBatch,
+                                  std::vector<Str>& results) const {
+  results.resize(substitutionsBatch.size());
+  for (std::size_t idx = 0; idx < substitutionsBatch.size(); ++idx) {
+    results[idx].clear();
+    renderTo(substitutionsBatch[idx], results[idx]);
+  }
+}
+
+void CompiledSubstitution::renderTo(const InfoDictionary& substitutions, Str& result) const {
+  for (const Segment& segment : segments_) {
+    if (segment.kind == Segment::Kind::kLiteral) {
+      result += segment.text;
+      continue;
+    }
+    const auto iter = substitutions.find(segment.text);
+    if (iter == substitutions.end()) {
+      throwSubstitutionError(input_, "argument not found");
+    }
+    try {
+      std::visit([&](const auto& value) { appendValue(value, segment.valueFormat, result); },
+                 iter->second);
+    } catch (const fmt::format_error& exc) {
+      throwSubstitutionError(input_, exc.what());
+    }
   }
 }
 
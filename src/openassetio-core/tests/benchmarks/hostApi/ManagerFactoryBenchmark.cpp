@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of manager plugin discovery and instantiation.
+ *
+ * Synthetic plugins are installed into several search path directories
+ * under the directory given by the
+ * `OPENASSETIO_BENCHMARK_CPP_PLUGINS_ROOT` environment variable. Each
+ * benchmark is repeated for an increasing number of search paths (and
+ * so an increasing number of plugins), in order to track how startup
+ * cost scales.
+ *
+ * "New factory" benchmarks construct a factory for each run, and
+ * destroy the previous run's factory (and its plugin system) within
+ * the timed region, so include scanning all plugins and tearing down.
+ * Note that these are not fully cold: plugin libraries are never
+ * unloaded once loaded, so only the first run in the process pays the
+ * cost of loading them from disk. "First" benchmarks time the first
+ * use of a factory that has already scanned. "Warm" benchmarks re-use
+ * a factory that has already been used.
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/SeverityFilter.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Identifiers;
+using openassetio::Str;
+using openassetio::hostApi::ManagerFactory;
+using openassetio::hostApi::ManagerFactoryPtr;
+using openassetio::hostApi::ManagerPtr;
+using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
+
+#ifdef _WIN32
+constexpr char kPathSep = ';';
+#else
+constexpr char kPathSep = ':';
+#endif
+
+struct BenchmarkHostInterface : openassetio::hostApi::HostInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.benchmark.host";
+  }
+  [[nodiscard]] Str displayName() const override { return "Benchmark Host"; }
+};
+
+/**
+ * Get the (sorted) list of synthetic plugin search path directories.
+ */
+std::vector<Str> pluginSearchPaths() {
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const char* root = std::getenv("OPENASSETIO_BENCHMARK_CPP_PLUGINS_ROOT");
+  REQUIRE(root != nullptr);
+
+  std::vector<Str> paths;
+  for (const auto& entry : std::filesystem::directory_iterator{root}) {
+    if (entry.is_directory()) {
+      paths.push_back(entry.path().string());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+/**
+ * Join the first @p count search paths into a single search path
+ * string.
+ */
+Str joinSearchPaths(const std::vector<Str>& paths, const std::size_t count) {
+  Str joined;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (idx != 0) {
+      joined += kPathSep;
+    }
+    joined += paths[idx];
+  }
+  return joined;
+}
+
+ManagerFactoryPtr makeManagerFactory(const Str& paths) {
+  const auto logger =
+      openassetio::log::SeverityFilter::make(openassetio::log::ConsoleLogger::make());
+  return ManagerFactory::make(std::make_shared<BenchmarkHostInterface>(),
+                              CppPluginSystemManagerImplementationFactory::make(paths, logger),
+                              logger);
+}
+}  // namespace
+
+TEST_CASE("C++ manager plugin discovery") {
+  const std::vector<Str> allPaths = pluginSearchPaths();
+  REQUIRE(!allPaths.empty());
+
+  // Double the number of search paths each iteration, always including
+  // the full set.
+  std::vector<std::size_t> pathCounts;
+  for (std::size_t count = 1; count < allPaths.size(); count *= 2) {
+    pathCounts.push_back(count);
+  }
+  pathCounts.push_back(allPaths.size());
+
+  for (const std::size_t pathCount : pathCounts) {
+    const Str paths = joinSearchPaths(allPaths, pathCount);
+    const std::size_t pluginCount = makeManagerFactory(paths)->identifiers().size();
+    REQUIRE(pluginCount > 0);
+
+    const std::string suffix =
+        " [" + std::to_string(pluginCount) + " plugins, " + std::to_string(pathCount) + " paths]";
+
+    BENCHMARK_ADVANCED("new ManagerFactory::make + identifiers" + suffix)
+    (Catch::Benchmark::Chronometer meter) {
+      ManagerFactoryPtr factory;
+      meter.measure([&] {
+        // Tear down the previous run.
+        factory.reset();
+        factory = makeManagerFactory(paths);
+        return factory->identifiers();
+      });
+    };
+
+    BENCHMARK_ADVANCED("warm identifiers" + suffix)(Catch::Benchmark::Chronometer meter) {
+      const ManagerFactoryPtr factory = makeManagerFactory(paths);
+      [[maybe_unused]] const Identifiers scanned = factory->identifiers();
+      meter.measure([&] { return factory->identifiers(); });
+    };
+
+    BENCHMARK_ADVANCED("new ManagerFactory::make + createManager" + suffix)
+    (Catch::Benchmark::Chronometer meter) {
+      // Last plugin found, i.e. worst case.
+      const auto identifier = makeManagerFactory(paths)->identifiers().back();
+      ManagerFactoryPtr factory;
+      ManagerPtr manager;
+      meter.measure([&] {
+        // Tear down the previous run.
+        manager.reset();
+        factory.reset();
+        factory = makeManagerFactory(paths);
+        manager = factory->createManager(identifier);
+      });
+    };
+
+    BENCHMARK_ADVANCED("first createManager after identifiers" + suffix)
+    (Catch::Benchmark::Chronometer meter) {
+      std::vector<ManagerFactoryPtr> factories;
+      std::vector<ManagerPtr> managers(static_cast<std::size_t>(meter.runs()));
+      Identifiers identifiers;
+      for (int run = 0; run < meter.runs(); ++run) {
+        factories.push_back(makeManagerFactory(paths));
+        identifiers = factories.back()->identifiers();
+      }
+      // Last plugin found, i.e. worst case.
+      const auto& identifier = identifiers.back();
+      meter.measure([&](const int run) {
+        const auto idx = static_cast<std::size_t>(run);
+        managers[idx] = factories[idx]->createManager(identifier);
+      });
+    };
+
+    BENCHMARK_ADVANCED("warm createManager" + suffix)(Catch::Benchmark::Chronometer meter) {
+      const ManagerFactoryPtr factory = makeManagerFactory(paths);
+      const auto identifier = factory->identifiers().back();
+      [[maybe_unused]] const ManagerPtr first = factory->createManager(identifier);
+      std::vector<ManagerPtr> managers(static_cast<std::size_t>(meter.runs()));
+      meter.measure([&](const int run) {
+        managers[static_cast<std::size_t>(run)] = factory->createManager(identifier);
+      });
+    };
+
+    BENCHMARK_ADVANCED("first initialize" + suffix)(Catch::Benchmark::Chronometer meter) {
+      const ManagerFactoryPtr factory = makeManagerFactory(paths);
+      const auto identifier = factory->identifiers().back();
+      std::vector<ManagerPtr> managers;
+      for (int run = 0; run < meter.runs(); ++run) {
+        managers.push_back(factory->createManager(identifier));
+      }
+      meter.measure([&](const int run) {
+        managers[static_cast<std::size_t>(run)]->initialize(openassetio::InfoDictionary{});
+      });
+    };
+  }
+}
@@ -0,0 +1,4 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>  // NOLINT(misc-include-cleaner)
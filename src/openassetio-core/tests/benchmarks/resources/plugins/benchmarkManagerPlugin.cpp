@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <memory>
+#include <utility>
+
+#include <export.h>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+// NOLINTNEXTLINE(misc-include-cleaner) - definition provided on command line.
+constexpr const char* kIdSuffix = OPENASSETIO_CORE_PLUGINSYSTEM_BENCHMARK_PLUGIN_ID_SUFFIX;
+
+/**
+ * Minimal manager that supports the capabilities required for a
+ * successful `Manager::initialize`, so that initialization latency can
+ * be benchmarked.
+ */
+struct BenchmarkManagerInterface : openassetio::managerApi::ManagerInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return openassetio::Identifier{"org.openassetio.benchmark.pluginSystem."} + kIdSuffix;
+  }
+
+  [[nodiscard]] openassetio::Str displayName() const override { return kIdSuffix; }
+
+  openassetio::InfoDictionary info() override {
+    return {{openassetio::Str{openassetio::constants::kInfoKey_EntityReferencesMatchPrefix},
+             openassetio::Str{kIdSuffix} + "://"}};
+  }
+
+  bool hasCapability(const Capability capability) override {
+    return capability == Capability::kEntityReferenceIdentification ||
+           capability == Capability::kManagementPolicyQueries ||
+           capability == Capability::kEntityTraitIntrospection;
+  }
+
+  void initialize(openassetio::InfoDictionary managerSettings,
+                  [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession)
+      override {
+    settings_ = std::move(managerSettings);
+  }
+
+  openassetio::InfoDictionary settings(
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    return settings_;
+  }
+
+ private:
+  openassetio::InfoDictionary settings_;
+};
+
+struct Plugin : openassetio::pluginSystem::CppPluginSystemManagerPlugin {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return openassetio::Identifier{"org.openassetio.benchmark.pluginSystem."} + kIdSuffix;
+  }
+  openassetio::managerApi::ManagerInterfacePtr interface() override {
+    return std::make_shared<BenchmarkManagerInterface>();
+  }
+};
+}  // namespace
+
+extern "C" {
+
+OPENASSETIO_CORE_PLUGINSYSTEM_BENCHMARK_EXPORT
+openassetio::pluginSystem::PluginFactory openassetioPlugin() noexcept {
+  return []() noexcept -> openassetio::pluginSystem::CppPluginSystemPluginPtr {
+    return std::make_shared<Plugin>();
+  };
+}
+}
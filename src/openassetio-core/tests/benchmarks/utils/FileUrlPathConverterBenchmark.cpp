@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of POSIX path/URL conversion.
+ *
+ * "Simple" inputs are absolute paths with no characters requiring
+ * encoding or normalisation, which take the fast, regex-free, path.
+ * "Complex" inputs are similar, but each has a single character that
+ * forces the general regex and URL parser based conversion, so the
+ * difference between the two indicates the speed-up of the fast path.
+ *
+ * "Long" inputs are deep paths with sparse characters that require
+ * percent-encoding, dominated by the cost of (un)escaping.
+ *
+ * "Cached" benchmarks repeatedly convert a frame sequence that fits in
+ * the converter's cache, comparing against an uncached converter.
+ *
+ * "Concurrent" benchmarks convert a fixed number of paths per thread
+ * using a single shared converter, so with perfect scaling the time
+ * is independent of the number of threads.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/path.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::FileUrlPathConverter;
+using openassetio::utils::PathType;
+
+constexpr std::string_view kSimplePath = "/mnt/projects/show/seq010/sh0100/comp/v012/render.exr";
+constexpr std::string_view kComplexPath =
+    "/mnt/projects/show/seq010/sh0100/comp/v012/render 1.exr";
+constexpr std::string_view kSimpleUrl =
+    "file:///mnt/projects/show/seq010/sh0100/comp/v012/render.exr";
+constexpr std::string_view kComplexUrl =
+    "file:///mnt/projects/show/seq010/sh0100/comp/v012/render%201.exr";
+constexpr std::string_view kLongPosixPath =
+    "/mnt/projects/long_show_name/sequences/seq010/shots/sh0100/departments/comp/"
+    "publish/v012/renders/beauty/linear/1920x1080/sh0100 comp beauty v012.1001.exr";
+constexpr std::string_view kLongUncPath =
+    R"(\\fileserver\projects\long_show_name\sequences\seq010\shots\sh0100\)"
+    R"(departments\comp\publish\v012\renders\beauty\sh0100 comp beauty v012.1001.exr)";
+
+constexpr std::size_t kNumConversionsPerThread = 1000;
+
+/// Convert paths to URLs on each of `numThreads` threads, sharing a
+/// single converter.
+std::size_t convertConcurrently(const FileUrlPathConverter& converter,
+                                const std::size_t numThreads) {
+  std::vector<std::size_t> totalSizes(numThreads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (std::size_t threadIdx = 0; threadIdx < numThreads; ++threadIdx) {
+    threads.emplace_back([&, threadIdx] {
+      for (std::size_t idx = 0; idx < kNumConversionsPerThread; ++idx) {
+        totalSizes[threadIdx] += converter.pathToUrl(kComplexPath, PathType::kPOSIX).size();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::size_t totalSize = 0;
+  for (const std::size_t size : totalSizes) {
+    totalSize += size;
+  }
+  return totalSize;
+}
+}  // namespace
+
+TEST_CASE("POSIX FileUrlPathConverter.pathToUrl") {
+  const FileUrlPathConverter converter;
+
+  BENCHMARK("simple") { return converter.pathToUrl(kSimplePath, PathType::kPOSIX); };
+  BENCHMARK("complex") { return converter.pathToUrl(kComplexPath, PathType::kPOSIX); };
+}
+
+TEST_CASE("POSIX FileUrlPathConverter.pathFromUrl") {
+  const FileUrlPathConverter converter;
+
+  BENCHMARK("simple") { return converter.pathFromUrl(kSimpleUrl, PathType::kPOSIX); };
+  BENCHMARK("complex") { return converter.pathFromUrl(kComplexUrl, PathType::kPOSIX); };
+}
+
+TEST_CASE("Long path percent-encoding") {
+  const FileUrlPathConverter converter;
+  const Str posixUrl = converter.pathToUrl(kLongPosixPath, PathType::kPOSIX);
+  const Str uncUrl = converter.pathToUrl(kLongUncPath, PathType::kWindows);
+
+  BENCHMARK("POSIX pathToUrl") { return converter.pathToUrl(kLongPosixPath, PathType::kPOSIX); };
+  BENCHMARK("POSIX pathFromUrl") { return converter.pathFromUrl(posixUrl, PathType::kPOSIX); };
+  BENCHMARK("UNC pathToUrl") { return converter.pathToUrl(kLongUncPath, PathType::kWindows); };
+  BENCHMARK("UNC pathFromUrl") { return converter.pathFromUrl(uncUrl, PathType::kWindows); };
+}
+
+TEST_CASE("Concurrent FileUrlPathConverter.pathToUrl") {
+  const FileUrlPathConverter converter;
+  const std::size_t maxThreads = std::max(std::thread::hardware_concurrency(), 2U);
+
+  BENCHMARK("1 thread") { return convertConcurrently(converter, 1); };
+  BENCHMARK("2 threads") { return convertConcurrently(converter, 2); };
+  BENCHMARK("all threads") { return convertConcurrently(converter, maxThreads); };
+}
+
+TEST_CASE("Cached FileUrlPathConverter frame sequence") {
+  constexpr std::size_t kNumFrames = 100;
+  std::vector<Str> paths;
+  paths.reserve(kNumFrames);
+  for (std::size_t frame = 0; frame < kNumFrames; ++frame) {
+    paths.push_back(Str{kLongPosixPath} + "." + std::to_string(1001 + frame));
+  }
+
+  const auto convertAll = [&](const FileUrlPathConverter& converter) {
+    std::size_t totalSize = 0;
+    for (const Str& path : paths) {
+      totalSize += converter.pathToUrl(path, PathType::kPOSIX).size();
+    }
+    return totalSize;
+  };
+
+  const FileUrlPathConverter uncachedConverter;
+  const FileUrlPathConverter cachedConverter{kNumFrames};
+
+  BENCHMARK("uncached") { return convertAll(uncachedConverter); };
+  BENCHMARK("cached") { return convertAll(cachedConverter); };
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of rendering a per-frame path template, comparing
+ * re-parsing the template each time via `substitute` against a
+ * pre-parsed `CompiledSubstitution`.
+ */
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/substitute.hpp>
+
+namespace {
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::utils::CompiledSubstitution;
+
+constexpr std::string_view kTemplate =
+    "/mnt/projects/{show}/{shot}/{department}/v{version:03d}/{shot}_{department}.{frame:04d}.exr";
+constexpr std::size_t kNumFrames = 100;
+
+std::vector<InfoDictionary> frameSubstitutions() {
+  std::vector<InfoDictionary> substitutions;
+  substitutions.reserve(kNumFrames);
+  for (std::size_t frame = 0; frame < kNumFrames; ++frame) {
+    substitutions.push_back({{"show", Str{"show"}},
+                             {"shot", Str{"sh0100"}},
+                             {"department", Str{"comp"}},
+                             {"version", Int{12}},
+                             {"frame", static_cast<Int>(1001 + frame)}});
+  }
+  return substitutions;
+}
+}  // namespace
+
+TEST_CASE("Frame sequence substitution") {
+  const std::vector<InfoDictionary> substitutions = frameSubstitutions();
+  const CompiledSubstitution compiled{kTemplate};
+  std::vector<Str> results;
+
+  BENCHMARK("substitute") {
+    std::size_t totalSize = 0;
+    for (const InfoDictionary& frame : substitutions) {
+      totalSize += openassetio::utils::substitute(kTemplate, frame).size();
+    }
+    return totalSize;
+  };
+
+  BENCHMARK("CompiledSubstitution.render") {
+    std::size_t totalSize = 0;
+    for (const InfoDictionary& frame : substitutions) {
+      totalSize += compiled.render(frame).size();
+    }
+    return totalSize;
+  };
+
+  BENCHMARK("CompiledSubstitution.render batch") {
+    compiled.render(substitutions, results);
+    return results.size();
+  };
+}
@@ -0,0 +1,359 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <variant>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+#include <trompeloeil.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/FederatedManagerInterface.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct MockHostInterface final : trompeloeil::mock_interface<hostApi::HostInterface> {
+  IMPLEMENT_CONST_MOCK0(identifier);
+  IMPLEMENT_CONST_MOCK0(displayName);
+};
+
+struct MockLoggerInterface final : trompeloeil::mock_interface<log::LoggerInterface> {
+  IMPLEMENT_MOCK2(log);
+};
+
+/**
+ * Barrier that records whether all expected participants arrived
+ * before timing out.
+ */
+class Rendezvous {
+ public:
+  explicit Rendezvous(const std::size_t expected) : expected_{expected} {}
+
+  bool arriveAndWait() {
+    std::unique_lock lock{mutex_};
+    ++arrived_;
+    condition_.notify_all();
+    return condition_.wait_for(lock, std::chrono::seconds{5},
+                               [this] { return arrived_ >= expected_; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::size_t expected_;
+  std::size_t arrived_{0};
+};
+
+struct FakeManagerState final : managerApi::ManagerStateBase {
+  explicit FakeManagerState(Str token) : token{std::move(token)} {}
+  Str token;
+};
+
+/**
+ * Child manager that claims entity references with a given prefix, and
+ * resolves them to a trait named after its identifier, with a
+ * property holding the entity reference.
+ */
+class FakeManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  FakeManagerInterface(Identifier identifier, Str prefix)
+      : identifier_{std::move(identifier)}, prefix_{std::move(prefix)} {}
+
+  [[nodiscard]] Identifier identifier() const override { return identifier_; }
+  [[nodiscard]] Str displayName() const override { return "Fake " + identifier_; }
+
+  [[nodiscard]] InfoDictionary info() override {
+    return {{Str{constants::kInfoKey_EntityReferencesMatchPrefix}, prefix_},
+            {"owner", identifier_}};
+  }
+
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr&) override {
+    return settings_;
+  }
+
+  [[nodiscard]] bool hasCapability(const Capability capability) override {
+    return capability != Capability::kPublishing;
+  }
+
+  void initialize(const InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr&) override {
+    settings_ = managerSettings;
+  }
+
+  [[nodiscard]] bool isEntityReferenceString(const Str& someString,
+                                             const managerApi::HostSessionPtr&) override {
+    return someString.rfind(prefix_, 0) == 0;
+  }
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet&,
+               const access::ResolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr&, const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback&) override {
+    if (rendezvous) {
+      allArrived = rendezvous->arriveAndWait();
+    }
+    if (throwOnResolve) {
+      throw errors::NotImplementedException{identifier_};
+    }
+    lastState = context->managerState;
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      auto traitsData = trait::TraitsData::make();
+      traitsData->setTraitProperty(identifier_, "ref", entityReferences[idx].toString());
+      successCallback(idx, std::move(traitsData));
+    }
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr&) override {
+    return std::make_shared<FakeManagerState>(identifier_);
+  }
+
+  [[nodiscard]] Str persistenceTokenForState(const managerApi::ManagerStateBasePtr& state,
+                                             const managerApi::HostSessionPtr&) override {
+    return std::static_pointer_cast<FakeManagerState>(state)->token;
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr&) override {
+    return std::make_shared<FakeManagerState>(token);
+  }
+
+  std::shared_ptr<Rendezvous> rendezvous;
+  bool allArrived{false};
+  bool throwOnResolve{false};
+  managerApi::ManagerStateBasePtr lastState;
+
+ private:
+  Identifier identifier_;
+  Str prefix_;
+  InfoDictionary settings_;
+};
+
+/**
+ * Fixture providing a FederatedManagerInterface with two initialized
+ * children.
+ */
+// NOLINTBEGIN(*-avoid-const-or-ref-data-members)
+struct FederatedManagerFixture {
+  FederatedManagerFixture() { federated->initialize({}, hostSession); }
+
+  const std::shared_ptr<FakeManagerInterface> childA =
+      std::make_shared<FakeManagerInterface>("org.openassetio.test.a", "a://");
+  const std::shared_ptr<FakeManagerInterface> childB =
+      std::make_shared<FakeManagerInterface>("org.openassetio.test.b", "b://");
+
+  const hostApi::FederatedManagerInterfacePtr federated =
+      hostApi::FederatedManagerInterface::make("org.openassetio.test.federated", {childA, childB});
+
+  const managerApi::HostSessionPtr hostSession =
+      managerApi::HostSession::make(managerApi::Host::make(std::make_shared<MockHostInterface>()),
+                                    std::make_shared<MockLoggerInterface>());
+
+  const ContextPtr context{Context::make()};
+
+  std::map<std::size_t, trait::TraitsDataPtr> results;
+  std::map<std::size_t, errors::BatchElementError> batchErrors;
+  std::size_t callbackCount{0};
+
+  void resolve(const EntityReferences& entityReferences) {
+    federated->resolve(
+        entityReferences, {}, access::ResolveAccess::kRead, context, hostSession,
+        [this](const std::size_t idx, trait::TraitsDataPtr traitsData) {
+          ++callbackCount;
+          results[idx] = std::move(traitsData);
+        },
+        [this](const std::size_t idx, errors::BatchElementError error) {
+          ++callbackCount;
+          batchErrors.insert({idx, std::move(error)});
+        });
+  }
+};
+// NOLINTEND(*-avoid-const-or-ref-data-members)
+}  // namespace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+SCENARIO("FederatedManagerInterface construction") {
+  using openassetio::hostApi::FederatedManagerInterface;
+
+  GIVEN("no children") {
+    THEN("construction fails") {
+      CHECK_THROWS_AS(FederatedManagerInterface::make("some.id", {}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+  GIVEN("a null child") {
+    THEN("construction fails") {
+      CHECK_THROWS_AS(FederatedManagerInterface::make("some.id", {nullptr}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("FederatedManagerInterface routes mixed batches to child managers") {
+  using openassetio::EntityReference;
+  using openassetio::Str;
+  using openassetio::trait::property::Value;
+
+  GIVEN("a federation of two child managers") {
+    openassetio::FederatedManagerFixture fixture;
+
+    THEN("entity reference prefix is not reported in info") {
+      const auto info = fixture.federated->info();
+      CHECK(info.count(Str{openassetio::constants::kInfoKey_EntityReferencesMatchPrefix}) == 0);
+      CHECK(std::get<Str>(info.at("owner")) == "org.openassetio.test.a");
+    }
+
+    THEN("entity reference strings are recognised if claimed by any child") {
+      CHECK(fixture.federated->isEntityReferenceString("a://x", fixture.hostSession));
+      CHECK(fixture.federated->isEntityReferenceString("b://x", fixture.hostSession));
+      CHECK_FALSE(fixture.federated->isEntityReferenceString("c://x", fixture.hostSession));
+    }
+
+    WHEN("a batch of interleaved entity references is resolved") {
+      fixture.resolve({EntityReference{"a://1"}, EntityReference{"b://1"},
+                       EntityReference{"c://1"}, EntityReference{"a://2"}});
+
+      THEN("each reference is resolved by its owning child at its original index") {
+        CHECK(fixture.callbackCount == 4);
+        REQUIRE(fixture.results.size() == 3);
+        Value value;
+        CHECK(fixture.results.at(0)->getTraitProperty(&value, "org.openassetio.test.a", "ref"));
+        CHECK(std::get<Str>(value) == "a://1");
+        CHECK(fixture.results.at(1)->getTraitProperty(&value, "org.openassetio.test.b", "ref"));
+        CHECK(std::get<Str>(value) == "b://1");
+        CHECK(fixture.results.at(3)->getTraitProperty(&value, "org.openassetio.test.a", "ref"));
+        CHECK(std::get<Str>(value) == "a://2");
+      }
+
+      AND_THEN("unclaimed references result in an invalid entity reference error") {
+        REQUIRE(fixture.batchErrors.size() == 1);
+        CHECK(fixture.batchErrors.at(2).code ==
+              openassetio::errors::BatchElementError::ErrorCode::kInvalidEntityReference);
+      }
+    }
+
+    AND_GIVEN("children that each block until the other is called") {
+      const auto rendezvous = std::make_shared<openassetio::Rendezvous>(2);
+      fixture.childA->rendezvous = rendezvous;
+      fixture.childB->rendezvous = rendezvous;
+
+      WHEN("a batch spanning both children is resolved") {
+        fixture.resolve({EntityReference{"a://1"}, EntityReference{"b://1"}});
+
+        THEN("children are called concurrently") {
+          CHECK(fixture.childA->allArrived);
+          CHECK(fixture.childB->allArrived);
+          CHECK(fixture.results.size() == 2);
+        }
+      }
+    }
+
+    AND_GIVEN("a child that throws") {
+      fixture.childA->throwOnResolve = true;
+
+      WHEN("a batch spanning both children is resolved") {
+        THEN("other children complete and the exception is propagated") {
+          CHECK_THROWS_AS(fixture.resolve({EntityReference{"a://1"}, EntityReference{"b://1"}}),
+                          openassetio::errors::NotImplementedException);
+          CHECK(fixture.results.size() == 1);
+          CHECK(fixture.results.count(1) == 1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("FederatedManagerInterface namespaces settings by child identifier") {
+  using openassetio::Str;
+
+  GIVEN("a federation of two child managers") {
+    openassetio::FederatedManagerFixture fixture;
+
+    WHEN("initialized with namespaced and non-namespaced settings") {
+      fixture.federated->initialize({{"org.openassetio.test.a/key", Str{"forA"}},
+                                     {"org.openassetio.test.b/key", Str{"forB"}},
+                                     {"common", Str{"forAll"}}},
+                                    fixture.hostSession);
+
+      THEN("settings are forwarded to children and reported namespaced") {
+        const auto settings = fixture.federated->settings(fixture.hostSession);
+        CHECK(settings == openassetio::InfoDictionary{
+                              {"org.openassetio.test.a/key", Str{"forA"}},
+                              {"org.openassetio.test.a/common", Str{"forAll"}},
+                              {"org.openassetio.test.b/key", Str{"forB"}},
+                              {"org.openassetio.test.b/common", Str{"forAll"}}});
+      }
+    }
+  }
+}
+
+SCENARIO("FederatedManagerInterface composes child manager state") {
+  using openassetio::Context;
+  using openassetio::EntityReference;
+  using openassetio::FakeManagerState;
+
+  GIVEN("a federation of two child managers") {
+    openassetio::FederatedManagerFixture fixture;
+
+    WHEN("a state is created and round-tripped through a persistence token") {
+      const auto state = fixture.federated->createState(fixture.hostSession);
+      const auto token = fixture.federated->persistenceTokenForState(state, fixture.hostSession);
+      const auto restoredState =
+          fixture.federated->stateFromPersistenceToken(token, fixture.hostSession);
+
+      THEN("the token is composed of child tokens") {
+        CHECK(token == "22:org.openassetio.test.a22:org.openassetio.test.b");
+      }
+
+      AND_WHEN("the restored state is used to resolve") {
+        fixture.context->managerState = restoredState;
+        fixture.resolve({EntityReference{"a://1"}, EntityReference{"b://1"}});
+
+        THEN("each child receives its own state") {
+          CHECK(std::static_pointer_cast<FakeManagerState>(fixture.childA->lastState)->token ==
+                "org.openassetio.test.a");
+          CHECK(std::static_pointer_cast<FakeManagerState>(fixture.childB->lastState)->token ==
+                "org.openassetio.test.b");
+        }
+      }
+    }
+
+    WHEN("a malformed persistence token is provided") {
+      const openassetio::Str token = GENERATE(
+          "99:x", " 22:org.openassetio.test.a22:org.openassetio.test.b",
+          "+22:org.openassetio.test.a22:org.openassetio.test.b",
+          "22x:org.openassetio.test.a22:org.openassetio.test.b");
+
+      THEN("an exception is thrown") {
+        CAPTURE(token);
+        CHECK_THROWS_AS(fixture.federated->stateFromPersistenceToken(token, fixture.hostSession),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
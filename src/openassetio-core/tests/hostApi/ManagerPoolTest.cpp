@@ -0,0 +1,458 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+#include <trompeloeil.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/hostApi/ManagerPool.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct MockHostInterface final : trompeloeil::mock_interface<hostApi::HostInterface> {
+  IMPLEMENT_CONST_MOCK0(identifier);
+  IMPLEMENT_CONST_MOCK0(displayName);
+};
+
+struct MockLoggerInterface final : trompeloeil::mock_interface<log::LoggerInterface> {
+  IMPLEMENT_MOCK2(log);
+};
+
+class FakeManagerInterface;
+
+struct FakeManagerState final : managerApi::ManagerStateBase {
+  FakeManagerState(const FakeManagerInterface* owner, Str token)
+      : owner{owner}, token{std::move(token)} {}
+  const FakeManagerInterface* owner;
+  Str token;
+};
+
+/**
+ * Stateful manager that records how it is used, and which states it
+ * created, so that tests can verify states are never shared between
+ * instances.
+ */
+class FakeManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.pool"; }
+  [[nodiscard]] Str displayName() const override { return "Pool Test Manager"; }
+  [[nodiscard]] InfoDictionary info() override { return {}; }
+
+  [[nodiscard]] bool hasCapability(const Capability) override { return true; }
+
+  void initialize(const InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr&) override {
+    if (managerSettings.count("fail")) {
+      throw errors::InputValidationException{"Bad settings"};
+    }
+    settings = managerSettings;
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr&) override {
+    return std::make_shared<FakeManagerState>(this, "state");
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr&) override {
+    return std::make_shared<FakeManagerState>(this, ownedState(parentState).token + "/child");
+  }
+
+  [[nodiscard]] Str persistenceTokenForState(const managerApi::ManagerStateBasePtr& state,
+                                             const managerApi::HostSessionPtr&) override {
+    ++tokenCount;
+    return ownedState(state).token;
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr&) override {
+    ++restoreCount;
+    return std::make_shared<FakeManagerState>(this, token);
+  }
+
+  /// Simulate a non-thread-safe call, flagging overlapping use.
+  void use() {
+    if (inUse.exchange(true)) {
+      overlapped = true;
+    }
+    std::this_thread::yield();
+    inUse = false;
+  }
+
+  InfoDictionary settings;
+  std::size_t tokenCount{0};
+  std::size_t restoreCount{0};
+  std::atomic<bool> inUse{false};
+  std::atomic<bool> overlapped{false};
+
+ private:
+  const FakeManagerState& ownedState(const managerApi::ManagerStateBasePtr& state) const {
+    const auto& fakeState = static_cast<const FakeManagerState&>(*state);
+    if (fakeState.owner != this) {
+      throw errors::InputValidationException{"State from another manager instance"};
+    }
+    return fakeState;
+  }
+};
+
+class FakeManagerImplementationFactory final
+    : public hostApi::ManagerImplementationFactoryInterface {
+ public:
+  using hostApi::ManagerImplementationFactoryInterface::ManagerImplementationFactoryInterface;
+
+  Identifiers identifiers() override { return {"org.openassetio.test.pool"}; }
+
+  managerApi::ManagerInterfacePtr instantiate(const Identifier&) override {
+    ++instantiateCount;
+    return std::make_shared<FakeManagerInterface>();
+  }
+
+  std::size_t instantiateCount{0};
+};
+
+struct ManagerPoolFixture {
+  static constexpr std::size_t kPoolSize = 3;
+
+  ManagerPoolFixture()
+      : hostSession{managerApi::HostSession::make(
+            managerApi::Host::make(std::make_shared<MockHostInterface>()),
+            std::make_shared<MockLoggerInterface>())} {
+    std::vector<hostApi::ManagerPtr> managers;
+    for (std::size_t idx = 0; idx < kPoolSize; ++idx) {
+      auto managerInterface = std::make_shared<FakeManagerInterface>();
+      managers.push_back(hostApi::Manager::make(managerInterface, hostSession));
+      managerInterfaces[managers.back()] = std::move(managerInterface);
+    }
+    pool = hostApi::ManagerPool::make(std::move(managers));
+    pool->initialize({{"key", "value"}});
+  }
+
+  FakeManagerInterface& interfaceFor(const hostApi::ManagerPool::Lease& lease) const {
+    return *managerInterfaces.at(lease.manager());
+  }
+
+  std::vector<hostApi::ManagerPool::Lease> acquireAll() const {
+    std::vector<hostApi::ManagerPool::Lease> leases;
+    for (std::size_t idx = 0; idx < kPoolSize; ++idx) {
+      leases.push_back(pool->acquire());
+    }
+    return leases;
+  }
+
+  managerApi::HostSessionPtr hostSession;
+  std::map<hostApi::ManagerPtr, std::shared_ptr<FakeManagerInterface>> managerInterfaces;
+  hostApi::ManagerPoolPtr pool;
+};
+
+const FakeManagerState& fakeState(const ContextPtr& context) {
+  return static_cast<const FakeManagerState&>(*context->managerState);
+}
+}  // namespace
+
+SCENARIO("ManagerPool construction") {
+  const auto hostSession = managerApi::HostSession::make(
+      managerApi::Host::make(std::make_shared<MockHostInterface>()),
+      std::make_shared<MockLoggerInterface>());
+
+  GIVEN("a ManagerFactory") {
+    const auto implementationFactory =
+        std::make_shared<FakeManagerImplementationFactory>(hostSession->logger());
+    const auto managerFactory = hostApi::ManagerFactory::make(
+        std::make_shared<MockHostInterface>(), implementationFactory, hostSession->logger());
+
+    WHEN("a pool is created") {
+      const hostApi::ManagerPoolPtr pool =
+          managerFactory->createManagerPool("org.openassetio.test.pool", 4);
+
+      THEN("the requested number of independent managers are instantiated") {
+        CHECK(pool->size() == 4);
+        CHECK(pool->identifier() == "org.openassetio.test.pool");
+        CHECK(implementationFactory->instantiateCount == 4);
+      }
+    }
+
+    WHEN("an empty pool is requested") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_MATCHES(
+            managerFactory->createManagerPool("org.openassetio.test.pool", 0),
+            errors::InputValidationException,
+            Catch::Message("ManagerPool: Size must be greater than zero"));
+      }
+    }
+  }
+
+  GIVEN("the same manager twice") {
+    const auto manager =
+        hostApi::Manager::make(std::make_shared<FakeManagerInterface>(), hostSession);
+
+    THEN("a pool cannot be constructed") {
+      CHECK_THROWS_MATCHES(
+          hostApi::ManagerPool::make({manager, manager}), errors::InputValidationException,
+          Catch::Message("ManagerPool: Managers must be distinct instances"));
+    }
+  }
+}
+
+SCENARIO("Leasing managers from a ManagerPool") {
+  GIVEN("an initialized pool") {
+    const ManagerPoolFixture fixture;
+    hostApi::ManagerPool& pool = *fixture.pool;
+
+    THEN("every manager has been initialized with the same settings") {
+      for (const auto& [manager, managerInterface] : fixture.managerInterfaces) {
+        CHECK(managerInterface->settings == InfoDictionary{{"key", "value"}});
+      }
+    }
+
+    WHEN("every manager is leased") {
+      std::vector<hostApi::ManagerPool::Lease> leases = fixture.acquireAll();
+
+      THEN("each lease is of a distinct manager") {
+        std::set<hostApi::ManagerPtr> leased;
+        for (const auto& lease : leases) {
+          leased.insert(lease.manager());
+        }
+        CHECK(leased.size() == ManagerPoolFixture::kPoolSize);
+      }
+
+      AND_THEN("no further managers can be leased without blocking") {
+        CHECK_FALSE(pool.tryAcquire().has_value());
+      }
+
+      AND_WHEN("a lease is released") {
+        const hostApi::ManagerPtr released = leases.back().manager();
+        leases.pop_back();
+
+        THEN("the released manager can be leased again") {
+          const std::optional<hostApi::ManagerPool::Lease> lease = pool.tryAcquire();
+          REQUIRE(lease.has_value());
+          CHECK(lease->manager() == released);
+        }
+      }
+    }
+
+    WHEN("many threads lease managers concurrently") {
+      std::vector<std::thread> threads;
+      for (std::size_t threadIdx = 0; threadIdx < 8; ++threadIdx) {
+        threads.emplace_back([&] {
+          for (std::size_t iteration = 0; iteration < 200; ++iteration) {
+            const hostApi::ManagerPool::Lease lease = pool.acquire();
+            fixture.interfaceFor(lease).use();
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+
+      THEN("no manager was used by more than one thread at a time") {
+        for (const auto& [manager, managerInterface] : fixture.managerInterfaces) {
+          CHECK_FALSE(managerInterface->overlapped);
+        }
+      }
+    }
+  }
+
+  GIVEN("a pool with a manager that fails to initialize") {
+    const ManagerPoolFixture fixture;
+
+    THEN("initialization re-throws the failure") {
+      CHECK_THROWS_MATCHES(fixture.pool->initialize({{"fail", true}}),
+                           errors::InputValidationException, Catch::Message("Bad settings"));
+
+      AND_THEN("managers can still be leased") {
+        CHECK(fixture.pool->tryAcquire().has_value());
+      }
+    }
+  }
+}
+
+SCENARIO("Using contexts with a ManagerPool") {
+  GIVEN("an initialized pool") {
+    const ManagerPoolFixture fixture;
+    hostApi::ManagerPool& pool = *fixture.pool;
+
+    WHEN("a context is created and mapped to every manager") {
+      const ContextPtr context = pool.createContext();
+      const std::vector<hostApi::ManagerPool::Lease> leases = fixture.acquireAll();
+
+      std::vector<ContextPtr> mappedContexts;
+      for (const auto& lease : leases) {
+        mappedContexts.push_back(lease.contextFor(context));
+      }
+
+      THEN("each mapped context has a state owned by the leased manager") {
+        for (std::size_t idx = 0; idx < leases.size(); ++idx) {
+          const FakeManagerInterface& managerInterface = fixture.interfaceFor(leases[idx]);
+          CHECK(fakeState(mappedContexts[idx]).owner == &managerInterface);
+          CHECK(fakeState(mappedContexts[idx]).token == "state");
+          CHECK(mappedContexts[idx]->locale == context->locale);
+        }
+      }
+
+      AND_THEN("the originating manager is given the original context") {
+        const auto origin = std::find(mappedContexts.begin(), mappedContexts.end(), context);
+        REQUIRE(origin != mappedContexts.end());
+        CHECK(fixture.interfaceFor(leases[origin - mappedContexts.begin()]).restoreCount == 0);
+      }
+
+      AND_THEN("other managers restore the state only once") {
+        for (std::size_t idx = 0; idx < leases.size(); ++idx) {
+          const ContextPtr remapped = leases[idx].contextFor(context);
+          CHECK(remapped->managerState == mappedContexts[idx]->managerState);
+        }
+        std::size_t restoreCount = 0;
+        for (const auto& [manager, managerInterface] : fixture.managerInterfaces) {
+          CHECK(managerInterface->restoreCount <= 1);
+          restoreCount += managerInterface->restoreCount;
+        }
+        CHECK(restoreCount == ManagerPoolFixture::kPoolSize - 1);
+      }
+
+      AND_THEN("mapped contexts can themselves be mapped to any manager") {
+        for (const auto& mappedContext : mappedContexts) {
+          for (const auto& lease : leases) {
+            CHECK(fakeState(lease.contextFor(mappedContext)).owner ==
+                  &fixture.interfaceFor(lease));
+          }
+        }
+      }
+
+      AND_THEN("every mapped context has the original persistence token") {
+        for (const auto& mappedContext : mappedContexts) {
+          CHECK(pool.persistenceTokenForContext(mappedContext) == "state");
+        }
+      }
+    }
+
+    WHEN("a child context is created") {
+      const ContextPtr parentContext = pool.createContext();
+      const ContextPtr childContext = pool.createChildContext(parentContext);
+
+      THEN("it has the child persistence token") {
+        CHECK(pool.persistenceTokenForContext(childContext) == "state/child");
+      }
+    }
+
+    WHEN("a context is restored from a persistence token") {
+      const ContextPtr context = pool.contextFromPersistenceToken("some token");
+
+      THEN("the given token is used without querying the manager") {
+        CHECK(pool.persistenceTokenForContext(context) == "some token");
+        for (const auto& [manager, managerInterface] : fixture.managerInterfaces) {
+          CHECK(managerInterface->tokenCount == 0);
+        }
+      }
+    }
+
+    WHEN("contexts are created whilst every manager is leased") {
+      const std::vector<hostApi::ManagerPool::Lease> leases = fixture.acquireAll();
+      const hostApi::ManagerPool::Lease& lease = leases.back();
+
+      const ContextPtr context = lease.createContext();
+      const ContextPtr childContext = lease.createChildContext(context);
+      const ContextPtr restoredContext = lease.contextFromPersistenceToken("some token");
+
+      THEN("the contexts are created by the held lease without blocking") {
+        CHECK(fakeState(context).owner == &fixture.interfaceFor(lease));
+        CHECK(fakeState(childContext).owner == &fixture.interfaceFor(lease));
+        CHECK(fakeState(restoredContext).owner == &fixture.interfaceFor(lease));
+      }
+
+      AND_THEN("the contexts can be mapped to any manager") {
+        for (const auto& otherLease : leases) {
+          CHECK(fakeState(otherLease.contextFor(context)).token == "state");
+          CHECK(fakeState(otherLease.contextFor(childContext)).token == "state/child");
+          CHECK(fakeState(otherLease.contextFor(restoredContext)).token == "some token");
+        }
+      }
+    }
+
+    WHEN("the original context is destroyed whilst a mapped context is in use") {
+      std::optional<ContextPtr> context = pool.createContext();
+      const std::vector<hostApi::ManagerPool::Lease> leases = fixture.acquireAll();
+
+      ContextPtr mappedContext;
+      for (const auto& lease : leases) {
+        if (ContextPtr candidate = lease.contextFor(*context); candidate != *context) {
+          mappedContext = std::move(candidate);
+          break;
+        }
+      }
+      REQUIRE(mappedContext);
+      context.reset();
+
+      // Create (and destroy) enough contexts to trigger purging of
+      // expired registry entries.
+      for (std::size_t idx = 0; idx < 1000; ++idx) {
+        CHECK(leases.front().createContext());
+      }
+
+      THEN("the mapped context retains its persistence token") {
+        CHECK(pool.persistenceTokenForContext(mappedContext) == "state");
+      }
+
+      AND_THEN("the mapped context can still be mapped to any manager") {
+        for (const auto& lease : leases) {
+          CHECK(fakeState(lease.contextFor(mappedContext)).owner == &fixture.interfaceFor(lease));
+          CHECK(fakeState(lease.contextFor(mappedContext)).token == "state");
+        }
+      }
+
+      AND_WHEN("the mapped context is also destroyed") {
+        const std::weak_ptr<managerApi::ManagerStateBase> mappedState =
+            mappedContext->managerState;
+        mappedContext.reset();
+
+        for (std::size_t idx = 0; idx < 1000; ++idx) {
+          CHECK(leases.front().createContext());
+        }
+
+        THEN("the pool releases the restored state") { CHECK(mappedState.expired()); }
+      }
+    }
+
+    WHEN("a context not created via the pool is mapped") {
+      const auto manager =
+          hostApi::Manager::make(std::make_shared<FakeManagerInterface>(), fixture.hostSession);
+      const ContextPtr context = manager->createContext();
+      const hostApi::ManagerPool::Lease lease = pool.acquire();
+
+      THEN("an exception is thrown") {
+        CHECK_THROWS_MATCHES(
+            lease.contextFor(context), errors::InputValidationException,
+            Catch::Message(
+                "ManagerPool: Context has a manager state that was not created via this pool"));
+      }
+    }
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
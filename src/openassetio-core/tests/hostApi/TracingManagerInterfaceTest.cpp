@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/TracingManagerInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+using hostApi::TracingManagerInterface;
+using Severity = log::LoggerInterface::Severity;
+
+struct FakeHostInterface final : hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override { return "fake.host"; }
+  [[nodiscard]] Str displayName() const override { return "Fake Host"; }
+};
+
+class RecordingLogger final : public log::LoggerInterface {
+ public:
+  explicit RecordingLogger(const Severity minSeverity) : minSeverity_{minSeverity} {}
+
+  void log(const Severity severity, const Str& message) override {
+    if (severity == Severity::kDebugApi) {
+      messages.push_back(message);
+    }
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity >= minSeverity_;
+  }
+
+  std::vector<Str> messages;
+
+ private:
+  Severity minSeverity_;
+};
+
+/**
+ * Manager that resolves references ending in "ok" and errors for
+ * others, optionally throwing or sleeping.
+ */
+class FakeManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  [[nodiscard]] Identifier identifier() const override { return "fake.manager"; }
+  [[nodiscard]] Str displayName() const override { return "Fake Manager"; }
+  [[nodiscard]] bool hasCapability(const Capability) override { return true; }
+
+  [[nodiscard]] bool isEntityReferenceString(const Str& someString,
+                                             const managerApi::HostSessionPtr&) override {
+    return someString.rfind("fake://", 0) == 0;
+  }
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet&,
+               const access::ResolveAccess, const ContextConstPtr&,
+               const managerApi::HostSessionPtr&, const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    std::this_thread::sleep_for(delay);
+    if (shouldThrow) {
+      throw std::runtime_error{"resolve failed"};
+    }
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref.size() >= 2 && ref.compare(ref.size() - 2, 2, "ok") == 0) {
+        successCallback(idx, trait::TraitsData::make());
+      } else {
+        errorCallback(idx, errors::BatchElementError{
+                               errors::BatchElementError::ErrorCode::kEntityResolutionError, ref});
+      }
+    }
+  }
+
+  std::chrono::milliseconds delay{0};
+  bool shouldThrow = false;
+};
+
+struct Fixture {
+  explicit Fixture(const Severity loggerSeverity = Severity::kDebugApi)
+      : logger{std::make_shared<RecordingLogger>(loggerSeverity)},
+        manager{std::make_shared<FakeManagerInterface>()},
+        hostSession{managerApi::HostSession::make(
+            managerApi::Host::make(std::make_shared<FakeHostInterface>()), logger)} {}
+
+  /// Resolve, returning the number of successes and errors.
+  std::pair<std::size_t, std::size_t> resolve(managerApi::ManagerInterface& managerInterface,
+                                              const EntityReferences& entityReferences) const {
+    std::size_t numSucceeded = 0;
+    std::size_t numFailed = 0;
+    managerInterface.resolve(
+        entityReferences, {"a", "b"}, access::ResolveAccess::kRead, nullptr, hostSession,
+        [&](std::size_t, const trait::TraitsDataPtr&) { ++numSucceeded; },
+        [&](std::size_t, const errors::BatchElementError&) { ++numFailed; });
+    return {numSucceeded, numFailed};
+  }
+
+  std::shared_ptr<RecordingLogger> logger;
+  std::shared_ptr<FakeManagerInterface> manager;
+  managerApi::HostSessionPtr hostSession;
+};
+
+bool startsWith(const Str& str, const Str& prefix) { return str.rfind(prefix, 0) == 0; }
+}  // namespace
+
+SCENARIO("TracingManagerInterface construction") {
+  GIVEN("a null manager interface") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(TracingManagerInterface::make(nullptr),
+                           errors::InputValidationException,
+                           Catch::Message("TracingManagerInterface: Manager interface cannot be "
+                                          "null"));
+    }
+  }
+
+  GIVEN("a manager interface") {
+    const Fixture fixture;
+    const auto tracer = TracingManagerInterface::make(fixture.manager);
+
+    THEN("untraced methods are forwarded") {
+      CHECK(tracer->managerInterface() == fixture.manager);
+      CHECK(tracer->identifier() == "fake.manager");
+      CHECK(tracer->displayName() == "Fake Manager");
+      CHECK(tracer->sampling().everyNthCall == 1);
+    }
+  }
+}
+
+SCENARIO("TracingManagerInterface call tracing") {
+  GIVEN("a tracer logging every call") {
+    Fixture fixture;
+    const auto tracer = TracingManagerInterface::make(fixture.manager);
+
+    WHEN("a batch call is made") {
+      const auto [numSucceeded, numFailed] =
+          fixture.resolve(*tracer, {EntityReference{"fake://1/ok"}, EntityReference{"fake://2"},
+                                    EntityReference{"fake://3/ok"}});
+
+      THEN("callbacks are forwarded") {
+        CHECK(numSucceeded == 2);
+        CHECK(numFailed == 1);
+      }
+
+      THEN("call is logged with arguments and result counts") {
+        REQUIRE(fixture.logger->messages.size() == 1);
+        const Str& message = fixture.logger->messages[0];
+        CAPTURE(message);
+        CHECK(startsWith(message,
+                         "fake.manager.resolve(entityReferences=['fake://1/ok', 'fake://2', "
+                         "'fake://3/ok'], traitSet={'a', 'b'}, resolveAccess=read) -> 2 "
+                         "succeeded, 1 failed in "));
+        CHECK(message.substr(message.size() - 3) == " ms");
+      }
+    }
+
+    WHEN("a large batch call is made") {
+      const EntityReferences entityReferences(10, EntityReference{"fake://ok"});
+      fixture.resolve(*tracer, entityReferences);
+
+      THEN("arguments are summarised") {
+        REQUIRE(fixture.logger->messages.size() == 1);
+        CHECK(startsWith(fixture.logger->messages[0],
+                         "fake.manager.resolve(entityReferences=['fake://ok', 'fake://ok', "
+                         "'fake://ok', ... 7 more], "));
+      }
+    }
+
+    WHEN("a non-batch call is made") {
+      CHECK(tracer->isEntityReferenceString("fake://x", fixture.hostSession));
+
+      THEN("call is logged with its result") {
+        REQUIRE(fixture.logger->messages.size() == 1);
+        CHECK(startsWith(fixture.logger->messages[0],
+                         "fake.manager.isEntityReferenceString(someString='fake://x') -> true"));
+      }
+    }
+
+    WHEN("a call throws") {
+      fixture.manager->shouldThrow = true;
+
+      THEN("exception is propagated and logged") {
+        CHECK_THROWS_MATCHES(fixture.resolve(*tracer, {EntityReference{"fake://ok"}}),
+                             std::runtime_error, Catch::Message("resolve failed"));
+        REQUIRE(fixture.logger->messages.size() == 1);
+        CHECK(fixture.logger->messages[0].find(") -> threw 'resolve failed' in ") !=
+              Str::npos);
+      }
+    }
+  }
+
+  GIVEN("a tracer and a logger that filters kDebugApi") {
+    Fixture fixture{Severity::kDebug};
+    const auto tracer = TracingManagerInterface::make(fixture.manager);
+
+    WHEN("a call is made") {
+      const auto [numSucceeded, numFailed] =
+          fixture.resolve(*tracer, {EntityReference{"fake://ok"}});
+
+      THEN("call is forwarded but not logged") {
+        CHECK(numSucceeded == 1);
+        CHECK(numFailed == 0);
+        CHECK(fixture.logger->messages.empty());
+      }
+    }
+  }
+}
+
+SCENARIO("TracingManagerInterface sampling") {
+  GIVEN("a tracer logging every third call") {
+    Fixture fixture;
+    TracingManagerInterface::Sampling sampling;
+    sampling.everyNthCall = 3;
+    const auto tracer = TracingManagerInterface::make(fixture.manager, sampling);
+
+    WHEN("several calls are made") {
+      for (std::size_t idx = 0; idx < 7; ++idx) {
+        fixture.resolve(*tracer, {EntityReference{"fake://ok"}});
+      }
+
+      THEN("every third call is logged") { CHECK(fixture.logger->messages.size() == 3); }
+    }
+  }
+
+  GIVEN("a tracer logging only slow calls") {
+    Fixture fixture;
+    TracingManagerInterface::Sampling sampling;
+    sampling.everyNthCall = 0;
+    sampling.slowCallThreshold = std::chrono::milliseconds{20};
+    const auto tracer = TracingManagerInterface::make(fixture.manager, sampling);
+
+    WHEN("a fast call is made") {
+      fixture.resolve(*tracer, {EntityReference{"fake://ok"}});
+
+      THEN("call is not logged") { CHECK(fixture.logger->messages.empty()); }
+    }
+
+    WHEN("a slow call is made") {
+      fixture.manager->delay = std::chrono::milliseconds{30};
+      fixture.resolve(*tracer, {EntityReference{"fake://ok"}});
+
+      THEN("call is logged") { CHECK(fixture.logger->messages.size() == 1); }
+    }
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/AsyncLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::log::AsyncLogger;
+using openassetio::log::LoggerInterface;
+using Severity = LoggerInterface::Severity;
+using Message = std::pair<Severity, Str>;
+
+/**
+ * Logger that records messages, optionally holding up the background
+ * thread until released.
+ */
+class RecordingLogger final : public LoggerInterface {
+ public:
+  void log(const Severity severity, const Str& message) override {
+    std::unique_lock lock{mutex_};
+    messages_.emplace_back(severity, message);
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return !isHeld_; });
+    if (shouldThrow_) {
+      throw std::runtime_error{"Upstream failure"};
+    }
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity >= Severity::kInfo;
+  }
+
+  void hold() {
+    const std::lock_guard lock{mutex_};
+    isHeld_ = true;
+  }
+
+  void release() {
+    const std::lock_guard lock{mutex_};
+    isHeld_ = false;
+    cv_.notify_all();
+  }
+
+  void setShouldThrow() {
+    const std::lock_guard lock{mutex_};
+    shouldThrow_ = true;
+  }
+
+  void waitForCount(const std::size_t count) {
+    std::unique_lock lock{mutex_};
+    cv_.wait(lock, [&] { return messages_.size() >= count; });
+  }
+
+  std::vector<Message> messages() {
+    const std::lock_guard lock{mutex_};
+    return messages_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Message> messages_;
+  bool isHeld_{false};
+  bool shouldThrow_{false};
+};
+}  // namespace
+
+SCENARIO("AsyncLogger construction") {
+  GIVEN("a null upstream logger") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          AsyncLogger::make(nullptr), openassetio::errors::InputValidationException,
+          Catch::Message("AsyncLogger: Upstream logger cannot be null"));
+    }
+  }
+
+  GIVEN("a zero capacity") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          AsyncLogger::make(std::make_shared<RecordingLogger>(), 0),
+          openassetio::errors::InputValidationException,
+          Catch::Message("AsyncLogger: Capacity must be greater than zero"));
+    }
+  }
+
+  GIVEN("an upstream logger") {
+    const auto upstreamLogger = std::make_shared<RecordingLogger>();
+
+    WHEN("an AsyncLogger is constructed") {
+      const auto logger = AsyncLogger::make(upstreamLogger);
+
+      THEN("upstream logger is available") { CHECK(logger->upstreamLogger() == upstreamLogger); }
+
+      THEN("severity check is delegated to upstream logger") {
+        CHECK_FALSE(logger->isSeverityLogged(Severity::kDebug));
+        CHECK(logger->isSeverityLogged(Severity::kInfo));
+      }
+    }
+  }
+}
+
+SCENARIO("AsyncLogger message delivery") {
+  GIVEN("an AsyncLogger wrapping an upstream logger") {
+    const auto upstreamLogger = std::make_shared<RecordingLogger>();
+    auto logger = AsyncLogger::make(upstreamLogger);
+
+    WHEN("messages are logged and flushed") {
+      logger->log(Severity::kInfo, "first");
+      logger->log(Severity::kDebug, "filtered");
+      logger->log(Severity::kError, "second");
+      logger->flush();
+
+      THEN("messages that pass the upstream filter are delivered in order") {
+        CHECK(upstreamLogger->messages() ==
+              std::vector<Message>{{Severity::kInfo, "first"}, {Severity::kError, "second"}});
+      }
+    }
+
+    WHEN("messages are logged and the logger is destroyed") {
+      upstreamLogger->hold();
+      logger->log(Severity::kInfo, "first");
+      logger->log(Severity::kInfo, "second");
+      upstreamLogger->waitForCount(1);
+
+      std::thread destroyer{[&] { logger.reset(); }};
+      upstreamLogger->release();
+      destroyer.join();
+
+      THEN("all messages are delivered") {
+        CHECK(upstreamLogger->messages() ==
+              std::vector<Message>{{Severity::kInfo, "first"}, {Severity::kInfo, "second"}});
+      }
+    }
+
+    WHEN("the upstream logger throws") {
+      upstreamLogger->setShouldThrow();
+      logger->log(Severity::kInfo, "first");
+      logger->log(Severity::kInfo, "second");
+      logger->flush();
+
+      THEN("exceptions are discarded and subsequent messages delivered") {
+        CHECK(upstreamLogger->messages().size() == 2);
+      }
+    }
+  }
+
+  GIVEN("an AsyncLogger shared between threads") {
+    constexpr std::size_t kNumThreads = 8;
+    constexpr std::size_t kNumMessages = 500;
+    const auto upstreamLogger = std::make_shared<RecordingLogger>();
+    // Small capacity, so producers frequently block.
+    const auto logger =
+        AsyncLogger::make(upstreamLogger, 16, AsyncLogger::OverflowPolicy::kBlock);
+
+    WHEN("messages are logged concurrently") {
+      std::vector<std::thread> threads;
+      threads.reserve(kNumThreads);
+      for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+        threads.emplace_back([&, threadIdx] {
+          for (std::size_t idx = 0; idx < kNumMessages; ++idx) {
+            logger->log(Severity::kInfo, fmt::format("{} {}", threadIdx, idx));
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      logger->flush();
+
+      THEN("no messages are lost and each thread's messages are in order") {
+        const auto messages = upstreamLogger->messages();
+        CHECK(messages.size() == kNumThreads * kNumMessages);
+        CHECK(logger->droppedCount() == 0);
+
+        std::vector<std::size_t> nextIdx(kNumThreads, 0);
+        std::size_t numOutOfOrder = 0;
+        for (const auto& [severity, message] : messages) {
+          const auto separator = message.find(' ');
+          const auto threadIdx = std::stoul(message.substr(0, separator));
+          const auto idx = std::stoul(message.substr(separator + 1));
+          numOutOfOrder += idx == nextIdx[threadIdx] ? 0 : 1;
+          nextIdx[threadIdx] = idx + 1;
+        }
+        CHECK(numOutOfOrder == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("AsyncLogger overflow") {
+  GIVEN("a held upstream logger and an AsyncLogger with the drop policy") {
+    const auto upstreamLogger = std::make_shared<RecordingLogger>();
+    const auto logger = AsyncLogger::make(upstreamLogger, 2, AsyncLogger::OverflowPolicy::kDrop);
+
+    upstreamLogger->hold();
+    // Wait until the background thread is held delivering a message,
+    // so the queue is empty.
+    logger->log(Severity::kInfo, "held");
+    upstreamLogger->waitForCount(1);
+
+    WHEN("more messages are logged than the queue can hold") {
+      for (std::size_t idx = 0; idx < 5; ++idx) {
+        logger->log(Severity::kInfo, fmt::format("{}", idx));
+      }
+
+      THEN("excess messages are dropped and counted") { CHECK(logger->droppedCount() == 3); }
+
+      AND_WHEN("the upstream logger is released") {
+        upstreamLogger->release();
+        logger->flush();
+
+        THEN("a warning is delivered followed by queued messages") {
+          CHECK(upstreamLogger->messages() ==
+                std::vector<Message>{
+                    {Severity::kInfo, "held"},
+                    {Severity::kWarning, "AsyncLogger: 3 message(s) dropped due to a full queue"},
+                    {Severity::kInfo, "0"},
+                    {Severity::kInfo, "1"}});
+        }
+      }
+    }
+    upstreamLogger->release();
+  }
+
+  GIVEN("a held upstream logger and an AsyncLogger with the block policy") {
+    const auto upstreamLogger = std::make_shared<RecordingLogger>();
+    const auto logger = AsyncLogger::make(upstreamLogger, 2, AsyncLogger::OverflowPolicy::kBlock);
+
+    upstreamLogger->hold();
+    logger->log(Severity::kInfo, "held");
+    upstreamLogger->waitForCount(1);
+
+    WHEN("more messages are logged than the queue can hold") {
+      std::thread producer{[&] {
+        for (std::size_t idx = 0; idx < 5; ++idx) {
+          logger->log(Severity::kInfo, fmt::format("{}", idx));
+        }
+      }};
+      upstreamLogger->release();
+      producer.join();
+      logger->flush();
+
+      THEN("all messages are delivered") {
+        CHECK(upstreamLogger->messages().size() == 6);
+        CHECK(logger->droppedCount() == 0);
+      }
+    }
+    upstreamLogger->release();
+  }
+}
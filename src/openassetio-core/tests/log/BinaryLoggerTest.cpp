@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/BinaryLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::log::BinaryLogger;
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/// Path to a file in the temp directory, removed on destruction.
+struct TempFile {
+  explicit TempFile(const Str& name)
+      : path{(std::filesystem::temp_directory_path() / name).string()} {}
+  ~TempFile() { std::filesystem::remove(path); }
+  TempFile(const TempFile&) = delete;
+  TempFile(TempFile&&) noexcept = delete;
+  TempFile& operator=(const TempFile&) = delete;
+  TempFile& operator=(TempFile&&) noexcept = delete;
+
+  Str path;
+};
+}  // namespace
+
+SCENARIO("BinaryLogger round trip") {
+  GIVEN("a BinaryLogger") {
+    const TempFile file{"openassetio-BinaryLoggerTest-roundTrip.log"};
+    auto logger = BinaryLogger::make(file.path);
+    CHECK(logger->filePath() == file.path);
+
+    WHEN("messages are logged and flushed") {
+      logger->log(Severity::kInfo, "first");
+      logger->log(Severity::kError, "");
+      logger->log(Severity::kDebugApi, Str{"with\0null", 9});
+      logger->flush();
+
+      THEN("messages can be decoded") {
+        const auto records = BinaryLogger::decode(file.path);
+        REQUIRE(records.size() == 3);
+        CHECK(records[0].severity == Severity::kInfo);
+        CHECK(records[0].message == "first");
+        CHECK(records[1].severity == Severity::kError);
+        CHECK(records[1].message.empty());
+        CHECK(records[2].severity == Severity::kDebugApi);
+        CHECK(records[2].message == Str{"with\0null", 9});
+        CHECK(records[0].threadIndex == 0);
+        CHECK(records[0].timeSinceEpoch <= records[1].timeSinceEpoch);
+      }
+    }
+
+    WHEN("messages are logged without flushing") {
+      logger->log(Severity::kInfo, "buffered");
+
+      THEN("messages are not yet written") { CHECK(BinaryLogger::decode(file.path).empty()); }
+
+      AND_WHEN("the logger is destroyed") {
+        logger.reset();
+
+        THEN("messages are written") { CHECK(BinaryLogger::decode(file.path).size() == 1); }
+      }
+    }
+  }
+
+  GIVEN("a BinaryLogger with a small buffer") {
+    const TempFile file{"openassetio-BinaryLoggerTest-smallBuffer.log"};
+    const auto logger = BinaryLogger::make(file.path, 64);
+
+    WHEN("more messages are logged than fit in the buffer") {
+      for (std::size_t idx = 0; idx < 10; ++idx) {
+        logger->log(Severity::kInfo, fmt::format("message {}", idx));
+      }
+
+      THEN("full buffers are written without flushing") {
+        const auto records = BinaryLogger::decode(file.path);
+        CHECK(records.size() > 0);
+        CHECK(records.size() < 10);
+      }
+    }
+  }
+}
+
+SCENARIO("BinaryLogger concurrent logging") {
+  GIVEN("a BinaryLogger shared between threads") {
+    constexpr std::size_t kNumThreads = 4;
+    constexpr std::size_t kNumMessages = 1000;
+    const TempFile file{"openassetio-BinaryLoggerTest-concurrent.log"};
+    const auto logger = BinaryLogger::make(file.path, 256);
+
+    WHEN("messages are logged concurrently and flushed") {
+      std::vector<std::thread> threads;
+      threads.reserve(kNumThreads);
+      for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+        threads.emplace_back([&, threadIdx] {
+          for (std::size_t idx = 0; idx < kNumMessages; ++idx) {
+            logger->log(Severity::kInfo, fmt::format("{} {}", threadIdx, idx));
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      logger->flush();
+
+      THEN("all messages are decoded, in order for each thread") {
+        const auto records = BinaryLogger::decode(file.path);
+        CHECK(records.size() == kNumThreads * kNumMessages);
+
+        std::vector<std::vector<Str>> messagesByThreadIndex(kNumThreads);
+        for (const auto& record : records) {
+          REQUIRE(record.threadIndex < kNumThreads);
+          messagesByThreadIndex[record.threadIndex].push_back(record.message);
+        }
+        for (const auto& messages : messagesByThreadIndex) {
+          REQUIRE(messages.size() == kNumMessages);
+          const Str prefix = messages[0].substr(0, messages[0].find(' ') + 1);
+          std::size_t numOutOfOrder = 0;
+          for (std::size_t idx = 0; idx < kNumMessages; ++idx) {
+            numOutOfOrder += messages[idx] == fmt::format("{}{}", prefix, idx) ? 0 : 1;
+          }
+          CHECK(numOutOfOrder == 0);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("BinaryLogger thread exit") {
+  GIVEN("a BinaryLogger") {
+    constexpr std::size_t kNumThreads = 8;
+    const TempFile file{"openassetio-BinaryLoggerTest-threadExit.log"};
+    const auto logger = BinaryLogger::make(file.path);
+
+    WHEN("messages are logged by consecutive threads that then exit") {
+      // Consecutive threads are likely to be given the same thread ID.
+      for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+        std::thread{[&, threadIdx] { logger->log(Severity::kInfo, fmt::format("{}", threadIdx)); }}
+            .join();
+      }
+
+      THEN("messages are written without flushing, each with its own thread index") {
+        const auto records = BinaryLogger::decode(file.path);
+        REQUIRE(records.size() == kNumThreads);
+        for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+          CHECK(records[threadIdx].threadIndex == threadIdx);
+          CHECK(records[threadIdx].message == fmt::format("{}", threadIdx));
+        }
+      }
+    }
+  }
+
+  GIVEN("a thread that has logged to a BinaryLogger") {
+    const TempFile file{"openassetio-BinaryLoggerTest-threadExitAfterLogger.log"};
+    auto logger = BinaryLogger::make(file.path);
+    std::mutex mutex;
+    std::condition_variable stateChanged;
+    bool hasLogged = false;
+    bool isLoggerDestroyed = false;
+
+    std::thread thread{[&] {
+      logger->log(Severity::kInfo, "message");
+      std::unique_lock lock{mutex};
+      hasLogged = true;
+      stateChanged.notify_all();
+      stateChanged.wait(lock, [&] { return isLoggerDestroyed; });
+    }};
+    {
+      std::unique_lock lock{mutex};
+      stateChanged.wait(lock, [&] { return hasLogged; });
+    }
+
+    WHEN("the logger is destroyed before the thread exits") {
+      logger.reset();
+      {
+        const std::lock_guard lock{mutex};
+        isLoggerDestroyed = true;
+      }
+      stateChanged.notify_all();
+      thread.join();
+
+      THEN("the message is written once") {
+        const auto records = BinaryLogger::decode(file.path);
+        REQUIRE(records.size() == 1);
+        CHECK(records[0].message == "message");
+      }
+    }
+  }
+}
+
+SCENARIO("BinaryLogger decoding") {
+  GIVEN("a file with a truncated final record") {
+    const TempFile file{"openassetio-BinaryLoggerTest-truncated.log"};
+    {
+      const auto logger = BinaryLogger::make(file.path);
+      logger->log(Severity::kWarning, "complete");
+      logger->log(Severity::kWarning, "truncated");
+    }
+    std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 3);
+
+    THEN("complete records are decoded") {
+      const auto records = BinaryLogger::decode(file.path);
+      REQUIRE(records.size() == 1);
+      CHECK(records[0].message == "complete");
+    }
+  }
+
+  GIVEN("a file that is not a BinaryLogger file") {
+    const TempFile file{"openassetio-BinaryLoggerTest-invalid.log"};
+    std::ofstream{file.path} << "not a log";
+
+    THEN("decoding fails") {
+      CHECK_THROWS_MATCHES(
+          BinaryLogger::decode(file.path), openassetio::errors::InputValidationException,
+          Catch::Message(
+              fmt::format("BinaryLogger: '{}' is not a BinaryLogger file", file.path)));
+    }
+  }
+
+  GIVEN("a record") {
+    const BinaryLogger::Record record{
+        std::chrono::seconds{1700000000} + std::chrono::nanoseconds{42}, 3, Severity::kWarning,
+        "a message"};
+
+    THEN("record can be formatted as text") {
+      CHECK(BinaryLogger::formatRecord(record) ==
+            "2023-11-14T22:13:20.000000042Z [3] warning: a message");
+    }
+  }
+
+  GIVEN("a record with an out of range severity") {
+    const BinaryLogger::Record record{std::chrono::seconds{1700000000}, 3,
+                                      static_cast<Severity>(42), "a message"};
+
+    THEN("formatting fails") {
+      CHECK_THROWS_MATCHES(BinaryLogger::formatRecord(record),
+                           openassetio::errors::InputValidationException,
+                           Catch::Message("BinaryLogger: Invalid severity 42"));
+    }
+  }
+}
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/DuplicateFilter.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::log::DuplicateFilter;
+using openassetio::log::LoggerInterface;
+using Severity = LoggerInterface::Severity;
+using Message = std::pair<Severity, Str>;
+using Messages = std::vector<Message>;
+
+class RecordingLogger final : public LoggerInterface {
+ public:
+  void log(const Severity severity, const Str& message) override {
+    const std::lock_guard lock{mutex_};
+    messages_.emplace_back(severity, message);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity >= Severity::kInfo;
+  }
+
+  Messages messages() {
+    const std::lock_guard lock{mutex_};
+    return messages_;
+  }
+
+ private:
+  std::mutex mutex_;
+  Messages messages_;
+};
+
+constexpr std::chrono::hours kLongWindow{1};
+}  // namespace
+
+SCENARIO("DuplicateFilter construction") {
+  GIVEN("a null upstream logger") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          DuplicateFilter::make(nullptr), openassetio::errors::InputValidationException,
+          Catch::Message("DuplicateFilter: Upstream logger cannot be null"));
+    }
+  }
+
+  GIVEN("a zero window") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          DuplicateFilter::make(std::make_shared<RecordingLogger>(), std::chrono::seconds{0}),
+          openassetio::errors::InputValidationException,
+          Catch::Message("DuplicateFilter: Window must be greater than zero"));
+    }
+  }
+
+  GIVEN("an upstream logger") {
+    const auto upstream = std::make_shared<RecordingLogger>();
+    const auto filter = DuplicateFilter::make(upstream);
+
+    THEN("properties are as expected") {
+      CHECK(filter->upstreamLogger() == upstream);
+      CHECK(filter->window() == DuplicateFilter::kDefaultWindow);
+      CHECK(filter->isSeverityLogged(Severity::kInfo));
+      CHECK_FALSE(filter->isSeverityLogged(Severity::kDebug));
+    }
+  }
+}
+
+SCENARIO("DuplicateFilter suppression") {
+  GIVEN("a DuplicateFilter with a long window") {
+    const auto upstream = std::make_shared<RecordingLogger>();
+    const auto filter = DuplicateFilter::make(upstream, kLongWindow);
+
+    WHEN("a message is repeated") {
+      for (std::size_t idx = 0; idx < 5; ++idx) {
+        filter->log(Severity::kWarning, "repeated");
+      }
+
+      THEN("only the first occurrence is relayed") {
+        CHECK(upstream->messages() == Messages{{Severity::kWarning, "repeated"}});
+      }
+
+      AND_WHEN("the filter is flushed") {
+        filter->flush();
+
+        THEN("a summary of repeats is relayed") {
+          CHECK(upstream->messages() ==
+                Messages{{Severity::kWarning, "repeated"},
+                         {Severity::kWarning, "repeated (repeated 4 more times)"}});
+        }
+
+        AND_WHEN("the filter is flushed again") {
+          filter->flush();
+
+          THEN("no further summary is relayed") { CHECK(upstream->messages().size() == 2); }
+        }
+      }
+    }
+
+    WHEN("a message is repeated once and the filter destroyed") {
+      {
+        const auto localFilter = DuplicateFilter::make(upstream, kLongWindow);
+        localFilter->log(Severity::kError, "twice");
+        localFilter->log(Severity::kError, "twice");
+      }
+
+      THEN("a summary is relayed on destruction") {
+        CHECK(upstream->messages() ==
+              Messages{{Severity::kError, "twice"},
+                       {Severity::kError, "twice (repeated 1 more time)"}});
+      }
+    }
+
+    WHEN("the same text is logged at different severities") {
+      filter->log(Severity::kInfo, "text");
+      filter->log(Severity::kWarning, "text");
+
+      THEN("both are relayed") {
+        CHECK(upstream->messages() ==
+              Messages{{Severity::kInfo, "text"}, {Severity::kWarning, "text"}});
+      }
+    }
+
+    WHEN("distinct messages are logged") {
+      for (std::size_t idx = 0; idx < 100; ++idx) {
+        filter->log(Severity::kInfo, std::to_string(idx));
+      }
+      filter->flush();
+
+      THEN("all are relayed") { CHECK(upstream->messages().size() == 100); }
+    }
+
+    WHEN("messages are logged below the upstream severity") {
+      filter->log(Severity::kDebug, "filtered");
+      filter->log(Severity::kDebug, "filtered");
+      filter->flush();
+
+      THEN("nothing is relayed") { CHECK(upstream->messages().empty()); }
+    }
+  }
+
+  GIVEN("a DuplicateFilter with a short window") {
+    const auto upstream = std::make_shared<RecordingLogger>();
+    const auto filter = DuplicateFilter::make(upstream, std::chrono::milliseconds{20});
+
+    WHEN("a message is repeated either side of the window elapsing") {
+      filter->log(Severity::kWarning, "repeated");
+      filter->log(Severity::kWarning, "repeated");
+      filter->log(Severity::kWarning, "repeated");
+      std::this_thread::sleep_for(std::chrono::milliseconds{40});
+      filter->log(Severity::kWarning, "repeated");
+
+      THEN("a summary is relayed, followed by the message") {
+        CHECK(upstream->messages() ==
+              Messages{{Severity::kWarning, "repeated"},
+                       {Severity::kWarning, "repeated (repeated 2 more times)"},
+                       {Severity::kWarning, "repeated"}});
+      }
+    }
+
+    WHEN("a message is repeated and a different message logged after the window elapses") {
+      filter->log(Severity::kWarning, "repeated");
+      filter->log(Severity::kWarning, "repeated");
+      std::this_thread::sleep_for(std::chrono::milliseconds{40});
+      filter->log(Severity::kInfo, "other");
+
+      THEN("the summary is relayed without flushing, followed by the message") {
+        CHECK(upstream->messages() ==
+              Messages{{Severity::kWarning, "repeated"},
+                       {Severity::kWarning, "repeated (repeated 1 more time)"},
+                       {Severity::kInfo, "other"}});
+      }
+    }
+
+    WHEN("a message is repeated and a different message logged within the window") {
+      filter->log(Severity::kWarning, "repeated");
+      filter->log(Severity::kWarning, "repeated");
+      filter->log(Severity::kInfo, "other");
+
+      THEN("the summary is not yet relayed") {
+        CHECK(upstream->messages() ==
+              Messages{{Severity::kWarning, "repeated"}, {Severity::kInfo, "other"}});
+      }
+    }
+  }
+}
+
+SCENARIO("DuplicateFilter concurrent logging") {
+  GIVEN("a DuplicateFilter shared between threads") {
+    constexpr std::size_t kNumThreads = 4;
+    constexpr std::size_t kNumMessages = 2000;
+    const auto upstream = std::make_shared<RecordingLogger>();
+    const auto filter = DuplicateFilter::make(upstream, kLongWindow);
+
+    WHEN("threads log a mix of repeated and distinct messages") {
+      std::vector<std::thread> threads;
+      threads.reserve(kNumThreads);
+      for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+        threads.emplace_back([&, threadIdx] {
+          for (std::size_t idx = 0; idx < kNumMessages; ++idx) {
+            filter->log(Severity::kWarning, "storm");
+            filter->log(Severity::kInfo, std::to_string(threadIdx * kNumMessages + idx));
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      filter->flush();
+
+      THEN("every repeated message is either relayed or counted") {
+        const std::regex summaryRegex{R"(storm \(repeated (\d+) more times?\))"};
+        std::size_t numStorm = 0;
+        for (const auto& [severity, message] : upstream->messages()) {
+          std::smatch match;
+          if (message == "storm") {
+            ++numStorm;
+          } else if (std::regex_match(message, match, summaryRegex)) {
+            numStorm += std::stoul(match[1]);
+          }
+        }
+        CHECK(numStorm == kNumThreads * kNumMessages);
+      }
+    }
+  }
+}
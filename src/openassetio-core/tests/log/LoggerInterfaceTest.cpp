@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::log::LoggerInterface;
+using Severity = LoggerInterface::Severity;
+using Message = std::pair<Severity, Str>;
+
+/// Logger that records messages, filtering out those below kWarning.
+class RecordingLogger final : public LoggerInterface {
+ public:
+  void log(const Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity >= Severity::kWarning;
+  }
+
+  std::vector<Message> messages;
+};
+}  // namespace
+
+SCENARIO("Lazily logging messages") {
+  GIVEN("a logger that filters some severities") {
+    RecordingLogger logger;
+    std::size_t numCalls = 0;
+    const auto messageFn = [&numCalls] {
+      ++numCalls;
+      return Str{"lazy message"};
+    };
+
+    WHEN("a message is logged lazily at a filtered severity") {
+      logger.logLazily(Severity::kDebug, messageFn);
+      logger.debugApi(messageFn);
+      logger.debug(messageFn);
+      logger.info(messageFn);
+      logger.progress(messageFn);
+
+      THEN("message is not constructed or logged") {
+        CHECK(numCalls == 0);
+        CHECK(logger.messages.empty());
+      }
+    }
+
+    WHEN("a message is logged lazily at a logged severity") {
+      logger.logLazily(Severity::kWarning, messageFn);
+      logger.warning(messageFn);
+      logger.error(messageFn);
+      logger.critical(messageFn);
+
+      THEN("message is constructed and logged") {
+        CHECK(numCalls == 4);
+        CHECK(logger.messages == std::vector<Message>{{Severity::kWarning, "lazy message"},
+                                                      {Severity::kWarning, "lazy message"},
+                                                      {Severity::kError, "lazy message"},
+                                                      {Severity::kCritical, "lazy message"}});
+      }
+    }
+
+    WHEN("a string message is logged at a filtered severity") {
+      logger.debug("eager message");
+
+      THEN("message is passed to the logger regardless") {
+        CHECK(logger.messages == std::vector<Message>{{Severity::kDebug, "eager message"}});
+      }
+    }
+  }
+}
@@ -14,7 +14,10 @@
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/AsyncLogger.hpp>
+#include <openassetio/log/BinaryLogger.hpp>
 #include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/DuplicateFilter.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/log/SeverityFilter.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
@@ -48,7 +51,10 @@ using ClassesWithPtrAlias = std::tuple<
     CLASS_AND_PTRS(hostApi::Manager),
     CLASS_AND_PTRS(hostApi::ManagerFactory),
     CLASS_AND_PTRS(hostApi::ManagerImplementationFactoryInterface),
+    CLASS_AND_PTRS(log::AsyncLogger),
+    CLASS_AND_PTRS(log::BinaryLogger),
     CLASS_AND_PTRS(log::ConsoleLogger),
+    CLASS_AND_PTRS(log::DuplicateFilter),
     CLASS_AND_PTRS(log::LoggerInterface),
     CLASS_AND_PTRS(log::SeverityFilter),
     CLASS_AND_PTRS(managerApi::EntityReferencePagerInterface),
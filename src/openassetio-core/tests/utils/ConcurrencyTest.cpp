@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <utils/concurrency.hpp>
+
+namespace {
+using openassetio::utils::invokeConcurrently;
+
+/// Number of threads that have made a call, across all tests.
+std::atomic<std::size_t> gNumThreadsSeen{0};
+
+/// Count the calling thread in gNumThreadsSeen, once per thread.
+void countThread() {
+  struct ThreadCounter {
+    ThreadCounter() { ++gNumThreadsSeen; }
+  };
+  thread_local const ThreadCounter tCounter;
+}
+
+/**
+ * Barrier that records whether all expected participants arrived
+ * before timing out.
+ */
+class Rendezvous {
+ public:
+  explicit Rendezvous(const std::size_t numExpected) : numExpected_{numExpected} {}
+
+  bool arriveAndWait() {
+    std::unique_lock lock{mutex_};
+    ++numArrived_;
+    allArrived_.notify_all();
+    return allArrived_.wait_for(lock, std::chrono::seconds{10},
+                                [this] { return numArrived_ == numExpected_; });
+  }
+
+ private:
+  const std::size_t numExpected_;
+  std::size_t numArrived_{0};
+  std::mutex mutex_;
+  std::condition_variable allArrived_;
+};
+}  // namespace
+
+SCENARIO("Invoking work concurrently") {
+  GIVEN("a number of calls to make") {
+    const std::size_t count = GENERATE(0U, 1U, 2U, 8U);
+    std::vector<std::atomic<std::size_t>> numCalls(count);
+
+    WHEN("the calls are invoked concurrently") {
+      const auto exceptions = invokeConcurrently(
+          count, [&](const std::size_t idx) { ++numCalls[idx]; }, count / 2);
+
+      THEN("each call is made exactly once") {
+        for (const auto& numCall : numCalls) {
+          CHECK(numCall == 1);
+        }
+      }
+
+      AND_THEN("no exceptions are reported") {
+        CHECK(exceptions.size() == count);
+        for (const auto& exception : exceptions) {
+          CHECK_FALSE(exception);
+        }
+      }
+    }
+  }
+
+  GIVEN("calls that throw") {
+    constexpr std::size_t kCount = 4;
+
+    WHEN("the calls are invoked concurrently") {
+      const auto exceptions = invokeConcurrently(kCount, [](const std::size_t idx) {
+        if (idx % 2) {
+          throw std::runtime_error{std::to_string(idx)};
+        }
+      });
+
+      THEN("exceptions are reported in index order") {
+        REQUIRE(exceptions.size() == kCount);
+        CHECK_FALSE(exceptions[0]);
+        CHECK_FALSE(exceptions[2]);
+        CHECK_THROWS_WITH(std::rethrow_exception(exceptions[1]), "1");
+        CHECK_THROWS_WITH(std::rethrow_exception(exceptions[3]), "3");
+      }
+    }
+  }
+
+  GIVEN("calls that each wait for all the others") {
+    constexpr std::size_t kCount = 4;
+    Rendezvous rendezvous{kCount};
+    std::array<std::thread::id, kCount> threadIds{};
+    std::array<bool, kCount> allArrived{};
+
+    WHEN("the calls are invoked concurrently") {
+      constexpr std::size_t kCallerIdx = 2;
+      invokeConcurrently(
+          kCount,
+          [&](const std::size_t idx) {
+            threadIds[idx] = std::this_thread::get_id();
+            allArrived[idx] = rendezvous.arriveAndWait();
+          },
+          kCallerIdx);
+
+      THEN("all calls run at the same time") {
+        for (std::size_t idx = 0; idx < kCount; ++idx) {
+          CHECK(allArrived[idx]);
+        }
+      }
+
+      AND_THEN("the requested call is made on the calling thread") {
+        CHECK(threadIds[kCallerIdx] == std::this_thread::get_id());
+      }
+    }
+  }
+
+  GIVEN("calls that themselves invoke calls concurrently") {
+    constexpr std::size_t kCount = 4;
+    std::atomic<std::size_t> numInnerCalls{0};
+
+    WHEN("the calls are invoked concurrently") {
+      invokeConcurrently(kCount, [&](std::size_t) {
+        invokeConcurrently(kCount, [&](std::size_t) { ++numInnerCalls; });
+      });
+
+      THEN("all nested calls are made") { CHECK(numInnerCalls == kCount * kCount); }
+    }
+  }
+
+  GIVEN("many consecutive invocations") {
+    constexpr std::size_t kNumInvocations = 100;
+    constexpr std::size_t kCount = 2;
+
+    WHEN("each invocation is made") {
+      const std::size_t numThreadsSeenBefore = gNumThreadsSeen;
+      for (std::size_t invocation = 0; invocation < kNumInvocations; ++invocation) {
+        invokeConcurrently(kCount, [](std::size_t) { countThread(); });
+      }
+
+      THEN("worker threads are re-used across invocations") {
+        CHECK(gNumThreadsSeen - numThreadsSeenBefore < kNumInvocations / 2);
+      }
+    }
+  }
+}
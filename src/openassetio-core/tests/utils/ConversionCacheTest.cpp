@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+#include <catch2/catch.hpp>
+
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/path.hpp>
+
+#include <utils/path/conversionCache.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::PathType;
+using openassetio::utils::path::ConversionCache;
+using Direction = ConversionCache::Direction;
+}  // namespace
+
+SCENARIO("Conversion cache lookup") {
+  GIVEN("a cache with an entry") {
+    ConversionCache cache{4};
+    cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/a", "file:///a");
+
+    THEN("the entry can be found") {
+      CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a") == "file:///a");
+    }
+
+    THEN("the entry is not found for a different direction or path type") {
+      CHECK(cache.find(Direction::kPathFromUrl, PathType::kPOSIX, "/a") == std::nullopt);
+      CHECK(cache.find(Direction::kPathToUrl, PathType::kWindows, "/a") == std::nullopt);
+    }
+
+    THEN("statistics count hits and misses") {
+      CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a").has_value());
+      CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a").has_value());
+      CHECK_FALSE(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/b").has_value());
+
+      const auto statistics = cache.statistics();
+      CHECK(statistics.hits == 2);
+      CHECK(statistics.misses == 1);
+      CHECK(statistics.size == 1);
+      CHECK(statistics.capacity == 4);
+    }
+
+    WHEN("the same input is inserted again") {
+      cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/a", "other");
+
+      THEN("the original entry is kept") {
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a") == "file:///a");
+        CHECK(cache.statistics().size == 1);
+      }
+    }
+  }
+}
+
+SCENARIO("Conversion cache eviction") {
+  GIVEN("a full cache") {
+    ConversionCache cache{3};
+    cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/a", "A");
+    cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/b", "B");
+    cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/c", "C");
+
+    WHEN("an entry is used and a new entry is inserted") {
+      CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a").has_value());
+      cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/d", "D");
+
+      THEN("the least recently used entry is evicted") {
+        CHECK(cache.statistics().size == 3);
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/a") == "A");
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/b") == std::nullopt);
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/c") == "C");
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/d") == "D");
+      }
+    }
+
+    WHEN("all entries are used and a new entry is inserted") {
+      for (const char* input : {"/a", "/b", "/c"}) {
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, input).has_value());
+      }
+      cache.insert(Direction::kPathToUrl, PathType::kPOSIX, "/d", "D");
+
+      THEN("an entry is still evicted") {
+        CHECK(cache.statistics().size == 3);
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, "/d") == "D");
+      }
+    }
+  }
+
+  GIVEN("a large cache") {
+    constexpr std::size_t kCapacity = 1000;
+    ConversionCache cache{kCapacity};
+
+    WHEN("many more entries than capacity are inserted") {
+      for (std::size_t idx = 0; idx < kCapacity * 3; ++idx) {
+        const Str input = fmt::format("/{}", idx);
+        cache.insert(Direction::kPathToUrl, PathType::kPOSIX, input, "file://" + input);
+      }
+
+      THEN("size is bounded by capacity") {
+        CHECK(cache.statistics().size <= kCapacity);
+      }
+
+      THEN("most recent entries are cached") {
+        const Str input = fmt::format("/{}", kCapacity * 3 - 1);
+        CHECK(cache.find(Direction::kPathToUrl, PathType::kPOSIX, input) == "file://" + input);
+      }
+    }
+  }
+}
+
+TEST_CASE("Conversion cache concurrent access") {
+  constexpr std::size_t kNumThreads = 8;
+  constexpr std::size_t kNumIterations = 2000;
+  // Smaller than the working set, to exercise eviction.
+  constexpr std::size_t kCapacity = 256;
+  constexpr std::size_t kNumInputs = 512;
+
+  ConversionCache cache{kCapacity};
+  std::vector<std::size_t> numMismatches(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+
+  for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+    threads.emplace_back([&, threadIdx] {
+      for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+        const Str input = fmt::format("/{}", (iteration * (threadIdx + 1)) % kNumInputs);
+        const Str expected = "file://" + input;
+        if (const auto output = cache.find(Direction::kPathToUrl, PathType::kPOSIX, input)) {
+          numMismatches[threadIdx] += *output == expected ? 0 : 1;
+        } else {
+          cache.insert(Direction::kPathToUrl, PathType::kPOSIX, input, expected);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(numMismatches == std::vector<std::size_t>(kNumThreads, 0));
+  const auto statistics = cache.statistics();
+  CHECK(statistics.hits + statistics.misses == kNumThreads * kNumIterations);
+  CHECK(statistics.size <= kCapacity);
+}
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/path.hpp>
+
+// Note pathTo/FromUrl tests in Python cover expected conversions, here
+// we're testing that a single instance can be shared between threads.
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::FileUrlPathConverter;
+using openassetio::utils::PathType;
+
+struct Conversion {
+  std::string_view input;
+  PathType pathType;
+  bool toUrl;
+};
+
+/// Mix of fast-path, regex-based and failing conversions.
+const std::vector<Conversion> kConversions{
+    {"/mnt/projects/show/sh0100/render.exr", PathType::kPOSIX, true},
+    {"/mnt/projects/show/sh0100/render 1.exr", PathType::kPOSIX, true},
+    {"/mnt/projects/../show/render.exr", PathType::kPOSIX, true},
+    {R"(C:\projects\show\sh0100\render 1.exr)", PathType::kWindows, true},
+    {R"(\\server\share\show\sh0100\render.exr)", PathType::kWindows, true},
+    {R"(\\?\UNC\server\share\show\render.exr)", PathType::kWindows, true},
+    {"file:///mnt/projects/show/sh0100/render.exr", PathType::kPOSIX, false},
+    {"file:///mnt/projects/show/sh0100/render%201.exr", PathType::kPOSIX, false},
+    {"file:///mnt/projects/show/%2F/render.exr", PathType::kPOSIX, false},
+    {"file:///C:/projects/show/sh0100/render%201.exr", PathType::kWindows, false},
+    {"file://server/share/show/sh0100/render.exr", PathType::kWindows, false},
+    {"https://server/share/show/sh0100/render.exr", PathType::kWindows, false},
+};
+
+/// Result of a conversion, or the message of the exception thrown.
+Str convert(const FileUrlPathConverter& converter, const Conversion& conversion) {
+  try {
+    return conversion.toUrl ? converter.pathToUrl(conversion.input, conversion.pathType)
+                            : converter.pathFromUrl(conversion.input, conversion.pathType);
+  } catch (const openassetio::errors::InputValidationException& exc) {
+    return Str{"error: "} + exc.what();
+  }
+}
+}  // namespace
+
+TEST_CASE("FileUrlPathConverter can be shared between threads") {
+  constexpr std::size_t kNumThreads = 8;
+  constexpr std::size_t kNumIterations = 500;
+
+  // No cache, a cache too small for all conversions (exercising
+  // eviction), and a cache large enough for all conversions.
+  const std::size_t cacheCapacity = GENERATE(0U, 4U, 1000U);
+  CAPTURE(cacheCapacity);
+  const FileUrlPathConverter converter{cacheCapacity};
+
+  std::vector<Str> expected;
+  expected.reserve(kConversions.size());
+  for (const Conversion& conversion : kConversions) {
+    expected.push_back(convert(converter, conversion));
+  }
+
+  std::vector<std::size_t> numMismatches(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+
+  for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+    threads.emplace_back([&, threadIdx] {
+      for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+        // Offset by thread, so threads are converting different inputs
+        // at any given moment.
+        for (std::size_t idx = 0; idx < kConversions.size(); ++idx) {
+          const std::size_t conversionIdx = (idx + threadIdx) % kConversions.size();
+          if (convert(converter, kConversions[conversionIdx]) != expected[conversionIdx]) {
+            ++numMismatches[threadIdx];
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(numMismatches == std::vector<std::size_t>(kNumThreads, 0));
+}
+
+SCENARIO("FileUrlPathConverter result caching") {
+  GIVEN("a converter without a cache") {
+    const FileUrlPathConverter converter;
+
+    THEN("statistics are empty") {
+      CHECK(converter.pathToUrl("/a", PathType::kPOSIX) == "file:///a");
+      const auto statistics = converter.cacheStatistics();
+      CHECK(statistics.hits == 0);
+      CHECK(statistics.misses == 0);
+      CHECK(statistics.size == 0);
+      CHECK(statistics.capacity == 0);
+    }
+  }
+
+  GIVEN("a converter with a cache") {
+    const FileUrlPathConverter uncachedConverter;
+    const FileUrlPathConverter converter{100};
+
+    THEN("cached results match uncached results") {
+      for (std::size_t repeat = 0; repeat < 2; ++repeat) {
+        for (const Conversion& conversion : kConversions) {
+          CHECK(convert(converter, conversion) == convert(uncachedConverter, conversion));
+        }
+      }
+    }
+
+    WHEN("the same inputs are converted repeatedly") {
+      for (std::size_t repeat = 0; repeat < 3; ++repeat) {
+        CHECK(converter.pathToUrl("/a b", PathType::kPOSIX) == "file:///a%20b");
+        CHECK(converter.pathFromUrl("file:///a%20b", PathType::kPOSIX) == "/a b");
+      }
+
+      THEN("only the first conversion of each is a miss") {
+        const auto statistics = converter.cacheStatistics();
+        CHECK(statistics.hits == 4);
+        CHECK(statistics.misses == 2);
+        CHECK(statistics.size == 2);
+        CHECK(statistics.capacity == 100);
+      }
+    }
+
+    WHEN("the same input is converted for different path types") {
+      CHECK(converter.pathFromUrl("file:///C:/a", PathType::kPOSIX) == "/C:/a");
+      CHECK(converter.pathFromUrl("file:///C:/a", PathType::kWindows) == R"(C:\a)");
+
+      THEN("results are cached separately") {
+        CHECK(converter.cacheStatistics().size == 2);
+        CHECK(converter.pathFromUrl("file:///C:/a", PathType::kPOSIX) == "/C:/a");
+        CHECK(converter.pathFromUrl("file:///C:/a", PathType::kWindows) == R"(C:\a)");
+      }
+    }
+
+    WHEN("an invalid input is converted repeatedly") {
+      for (std::size_t repeat = 0; repeat < 2; ++repeat) {
+        CHECK_THROWS_AS(converter.pathToUrl("/a/../b", PathType::kPOSIX),
+                        openassetio::errors::InputValidationException);
+      }
+
+      THEN("the error is not cached") {
+        const auto statistics = converter.cacheStatistics();
+        CHECK(statistics.hits == 0);
+        CHECK(statistics.misses == 2);
+        CHECK(statistics.size == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("FileUrlPathConverter batch conversion") {
+  // No cache, and a cache large enough for all conversions, so the
+  // second batch below consists of cache hits.
+  const std::size_t cacheCapacity = GENERATE(0U, 100U);
+  CAPTURE(cacheCapacity);
+  const FileUrlPathConverter converter{cacheCapacity};
+
+  GIVEN("batches of paths and URLs of mixed complexity") {
+    const std::vector<std::string_view> posixPaths{"/mnt/show/render.exr",
+                                                   "/mnt/show/render 1.exr", "/mnt//show/"};
+    const std::vector<std::string_view> windowsPaths{R"(C:\show\render 1.exr)",
+                                                     R"(\\server\share\render.exr)"};
+    const std::vector<std::string_view> posixUrls{
+        "file:///mnt/show/render.exr", "file:///mnt/show/render%201.exr", "file:///mnt/show/"};
+    const std::vector<std::string_view> windowsUrls{"file:///C:/show/render%201.exr",
+                                                    "file://server/share/render.exr"};
+
+    WHEN("the batches are converted") {
+      std::vector<Str> outputs;
+
+      THEN("results match single conversions") {
+        for (std::size_t repeat = 0; repeat < 2; ++repeat) {
+          converter.pathToUrl(posixPaths, outputs, PathType::kPOSIX);
+          REQUIRE(outputs.size() == posixPaths.size());
+          for (std::size_t idx = 0; idx < posixPaths.size(); ++idx) {
+            CHECK(outputs[idx] == converter.pathToUrl(posixPaths[idx], PathType::kPOSIX));
+          }
+
+          converter.pathToUrl(windowsPaths, outputs, PathType::kWindows);
+          REQUIRE(outputs.size() == windowsPaths.size());
+          for (std::size_t idx = 0; idx < windowsPaths.size(); ++idx) {
+            CHECK(outputs[idx] == converter.pathToUrl(windowsPaths[idx], PathType::kWindows));
+          }
+
+          converter.pathFromUrl(posixUrls, outputs, PathType::kPOSIX);
+          REQUIRE(outputs.size() == posixUrls.size());
+          for (std::size_t idx = 0; idx < posixUrls.size(); ++idx) {
+            CHECK(outputs[idx] == converter.pathFromUrl(posixUrls[idx], PathType::kPOSIX));
+          }
+
+          converter.pathFromUrl(windowsUrls, outputs, PathType::kWindows);
+          REQUIRE(outputs.size() == windowsUrls.size());
+          for (std::size_t idx = 0; idx < windowsUrls.size(); ++idx) {
+            CHECK(outputs[idx] == converter.pathFromUrl(windowsUrls[idx], PathType::kWindows));
+          }
+        }
+      }
+    }
+
+    WHEN("a batch is converted into an output vector with sufficient capacity") {
+      constexpr std::size_t kCapacity = 256;
+      REQUIRE(posixPaths.size() == posixUrls.size());
+      std::vector<Str> outputs(posixPaths.size());
+      std::vector<const char*> buffers;
+      for (Str& output : outputs) {
+        output.reserve(kCapacity);
+        buffers.push_back(output.data());
+      }
+
+      THEN("each element is converted in place, without reallocating") {
+        for (std::size_t repeat = 0; repeat < 2; ++repeat) {
+          converter.pathToUrl(posixPaths, outputs, PathType::kPOSIX);
+          for (std::size_t idx = 0; idx < outputs.size(); ++idx) {
+            CHECK(outputs[idx].data() == buffers[idx]);
+          }
+          converter.pathFromUrl(posixUrls, outputs, PathType::kPOSIX);
+          for (std::size_t idx = 0; idx < outputs.size(); ++idx) {
+            CHECK(outputs[idx].data() == buffers[idx]);
+          }
+          CHECK(outputs[0] == "/mnt/show/render.exr");
+        }
+      }
+    }
+  }
+}
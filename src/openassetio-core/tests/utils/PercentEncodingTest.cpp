@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <ada.h>
+#include <catch2/catch.hpp>
+
+#include <openassetio/typedefs.hpp>
+
+#include <utils/path/percentEncoding.hpp>
+#include <utils/path/posix/detail.hpp>
+#include <utils/path/windows/detail.hpp>
+
+// Differential tests of the vectorised percent-encoding kernels
+// against Ada, which they replace.
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::path::percentEncoding::CharacterSet;
+using openassetio::utils::path::percentEncoding::percentDecode;
+using openassetio::utils::path::percentEncoding::percentEncodeAndAppendTo;
+using openassetio::utils::path::percentEncoding::SimdLevel;
+using openassetio::utils::path::percentEncoding::supportedSimdLevel;
+
+/// All instruction sets supported by the running CPU.
+std::vector<SimdLevel> supportedSimdLevels() {
+  std::vector<SimdLevel> levels{SimdLevel::kScalar};
+  if (supportedSimdLevel() >= SimdLevel::kSSE2) {
+    levels.push_back(SimdLevel::kSSE2);
+  }
+  if (supportedSimdLevel() >= SimdLevel::kAVX2) {
+    levels.push_back(SimdLevel::kAVX2);
+  }
+  return levels;
+}
+
+/// Character sets in use, including one that disables the kernels.
+std::vector<CharacterSet> characterSets() {
+  CharacterSet allBytes{};
+  for (auto& byte : allBytes) {
+    byte = 0xFF;  // NOLINT(*-magic-numbers)
+  }
+  return {openassetio::utils::path::posix::detail::PosixUrl::kPercentEncodeCharacterSet,
+          openassetio::utils::path::windows::detail::WindowsUrl::kPercentEncodeCharacterSet,
+          allBytes};
+}
+
+/**
+ * Random strings, of lengths spanning several vector widths, mixing
+ * runs of safe characters with bytes that need (un)escaping.
+ */
+Str randomString(std::mt19937& engine) {
+  static constexpr char kChars[] =  // NOLINT(*-avoid-c-arrays)
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-./_"
+      "%%%2f2F :|\\?#\0\x7F\x80\xC3\xA9\xFF";
+  static constexpr std::string_view kAlphabet{kChars, sizeof(kChars) - 1};
+  constexpr std::size_t kMaxLength = 100;
+  constexpr std::size_t kSafePrefixLength = 66;
+
+  std::uniform_int_distribution<std::size_t> lengthDist{0, kMaxLength};
+  std::uniform_int_distribution<std::size_t> charDist{0, kAlphabet.size() - 1};
+  // Mostly safe characters, to exercise bulk copying.
+  std::uniform_int_distribution<std::size_t> safeCharDist{0, kSafePrefixLength - 1};
+  std::bernoulli_distribution isSafeDist{0.9};  // NOLINT(*-magic-numbers)
+
+  Str str(lengthDist(engine), '\0');
+  for (char& chr : str) {
+    chr = kAlphabet[isSafeDist(engine) ? safeCharDist(engine) : charDist(engine)];
+  }
+  return str;
+}
+
+constexpr std::size_t kNumIterations = 20000;
+}  // namespace
+
+TEST_CASE("Percent-encoding matches Ada") {
+  std::mt19937 engine{42};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    const Str input = randomString(engine);
+
+    for (const CharacterSet& charSet : characterSets()) {
+      Str expected;
+      const bool expectedEncoded =
+          ada::unicode::percent_encode<false>(input, charSet.data(), expected);
+
+      for (const SimdLevel simdLevel : supportedSimdLevels()) {
+        Str actual = "prefix";
+        const bool actualEncoded = percentEncodeAndAppendTo(input, charSet, actual, simdLevel);
+
+        if (actualEncoded != expectedEncoded ||
+            (expectedEncoded ? actual != "prefix" + expected : actual != "prefix")) {
+          FAIL_CHECK("percentEncode('" << input << "', " << static_cast<int>(simdLevel)
+                                       << "): '" << actual << "' != 'prefix" << expected
+                                       << "'");
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Percent-decoding matches Ada") {
+  std::mt19937 engine{42};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    const Str input = randomString(engine);
+    const Str expected = ada::unicode::percent_decode(input, input.find('%'));
+
+    for (const SimdLevel simdLevel : supportedSimdLevels()) {
+      const Str actual = percentDecode(input, simdLevel);
+      if (actual != expected) {
+        FAIL_CHECK("percentDecode('" << input << "', " << static_cast<int>(simdLevel)
+                                     << "): '" << actual << "' != '" << expected << "'");
+      }
+    }
+  }
+}
+
+TEST_CASE("Percent-encoding round-trips") {
+  const CharacterSet& charSet =
+      openassetio::utils::path::posix::detail::PosixUrl::kPercentEncodeCharacterSet;
+
+  // Long enough to span several vectors, with escapes at boundaries.
+  Str input(96, 'a');  // NOLINT(*-magic-numbers)
+  for (const std::size_t idx : {0, 15, 16, 31, 32, 63, 95}) {
+    input[idx] = ' ';
+  }
+
+  for (const SimdLevel simdLevel : supportedSimdLevels()) {
+    Str encoded;
+    REQUIRE(percentEncodeAndAppendTo(input, charSet, encoded, simdLevel));
+    CHECK(encoded.size() == input.size() + (7 * 2));
+    CHECK(percentDecode(encoded, simdLevel) == input);
+  }
+}
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <exception>
+#include <random>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include <utils/path/common.hpp>
+#include <utils/path/posix.hpp>
+#include <utils/path/posix/detail.hpp>
+
+// Note pathTo/FromUrl tests in Python cover expected conversions, here
+// we're testing that the fast path for simple POSIX paths is
+// indistinguishable from the general regex-based conversion.
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::path::ForwardSlashSeparatedString;
+using openassetio::utils::path::GenericUrl;
+using openassetio::utils::path::posix::FileUrlPathConverter;
+using openassetio::utils::path::posix::detail::PosixPath;
+using openassetio::utils::path::posix::detail::PosixUrl;
+
+/**
+ * Result of a conversion: either the converted string, or the message
+ * of the exception thrown.
+ */
+template <class Fn>
+Str resultOrError(const Fn& conversion) {
+  try {
+    return conversion();
+  } catch (const openassetio::errors::InputValidationException& exc) {
+    return Str{"error: "} + exc.what();
+  }
+}
+
+/**
+ * Generate random strings biased towards path-like content, including
+ * the characters that distinguish simple from non-simple paths.
+ */
+class PathLikeStringGenerator {
+ public:
+  Str operator()() {
+    // Half drawn from simple characters only (though may still form
+    // non-simple paths, e.g. `//` or `..`), half with a sprinkling of
+    // characters that require encoding, normalisation or validation.
+    static constexpr std::string_view kSimpleAlphabet = "abcXYZ019-_~..///";
+    static constexpr char kChars[] =  // NOLINT(*-avoid-c-arrays)
+        "abcXYZ019-_~......//////%%:|\\ ?#@!$&'()*+,;=[]\t\n\0\xC3\xA9";
+    // Explicit size, since the alphabet contains a `\0`.
+    static constexpr std::string_view kFullAlphabet{kChars, sizeof(kChars) - 1};
+
+    const std::string_view alphabet =
+        std::bernoulli_distribution{}(engine_) ? kSimpleAlphabet : kFullAlphabet;
+    std::uniform_int_distribution<std::size_t> lengthDist{0, 24};
+    std::uniform_int_distribution<std::size_t> charDist{0, alphabet.size() - 1};
+
+    Str str = "/";
+    const std::size_t length = lengthDist(engine_);
+    for (std::size_t idx = 0; idx < length; ++idx) {
+      str += alphabet[charDist(engine_)];
+    }
+    // Occasionally test relative paths.
+    if (charDist(engine_) == 0) {
+      str.erase(0, 1);
+    }
+    return str;
+  }
+
+ private:
+  // Fixed seed, so failures are reproducible.
+  std::mt19937 engine_{42};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+};
+
+constexpr std::size_t kNumIterations = 50000;
+}  // namespace
+
+TEST_CASE("Simple POSIX path detection") {
+  CHECK(PosixPath::isSimpleAbsolutePath("/"));
+  CHECK(PosixPath::isSimpleAbsolutePath("/a/b.c/d_e-f~g/"));
+  CHECK(PosixPath::isSimpleAbsolutePath("/.hidden/file."));
+
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath(""));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("a/b"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("//a"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/a//b"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/a/./b"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/a/.."));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/a/b c"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/a%20b"));
+  CHECK_FALSE(PosixPath::isSimpleAbsolutePath("/C:/a"));
+
+  CHECK(PosixUrl::simplePath("file:///a/b") == "/a/b");
+  CHECK_FALSE(PosixUrl::simplePath("FILE:///a/b").has_value());
+  CHECK_FALSE(PosixUrl::simplePath("file://host/a/b").has_value());
+  CHECK_FALSE(PosixUrl::simplePath("file:///a%2Fb").has_value());
+}
+
+TEST_CASE("POSIX fast path is equivalent to general conversion") {
+  ForwardSlashSeparatedString forwardSlashSeparatedStringHandler;
+  PosixPath posixPathHandler{forwardSlashSeparatedStringHandler};
+  PosixUrl posixUrlHandler;
+  const FileUrlPathConverter converter{posixUrlHandler, posixPathHandler};
+  const GenericUrl urlHandler;
+
+  PathLikeStringGenerator generator;
+  std::size_t numSimplePaths = 0;
+  std::size_t numSimpleUrls = 0;
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    const Str path = generator();
+    // Precondition of conversion functions.
+    if (path.empty()) {
+      continue;
+    }
+
+    numSimplePaths += PosixPath::isSimpleAbsolutePath(path) ? 1 : 0;
+
+    const Str expectedUrl = resultOrError([&] { return converter.pathToUrlGeneral(path); });
+    const Str actualUrl = resultOrError([&] { return converter.pathToUrl(path); });
+    if (actualUrl != expectedUrl) {
+      FAIL_CHECK("pathToUrl('" << path << "'): '" << actualUrl << "' != '" << expectedUrl
+                               << "'");
+    }
+
+    for (const Str& url : {"file://" + path, "FILE://" + path, "file://host" + path}) {
+      numSimpleUrls += PosixUrl::simplePath(url) ? 1 : 0;
+
+      if (urlHandler.isFileUrl(url) != urlHandler.fileUrlRegex.match(url).has_value()) {
+        FAIL_CHECK("isFileUrl('" << url << "')");
+      }
+
+      const Str expectedPath = resultOrError([&] { return converter.pathFromUrlGeneral(url); });
+      const Str actualPath = resultOrError([&] { return converter.pathFromUrl(url); });
+      if (actualPath != expectedPath) {
+        FAIL_CHECK("pathFromUrl('" << url << "'): '" << actualPath << "' != '" << expectedPath
+                                   << "'");
+      }
+    }
+  }
+
+  // Ensure both fast and general paths were well exercised.
+  CHECK(numSimplePaths > kNumIterations / 10);
+  CHECK(numSimplePaths < kNumIterations / 2);
+  CHECK(numSimpleUrls > kNumIterations / 10);
+}
@@ -1,8 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include <fmt/core.h>
+#include <fmt/format.h>
 #include <catch2/catch.hpp>
 
 #include <openassetio/errors/exceptions.hpp>
@@ -68,3 +72,174 @@ TEST_CASE("Invalid substitution exception") {
       ExceptionMessageMatcher{
           "Error -48 substituting regex matches in 'a' with 'aa': no more memory"});
 }
+
+SCENARIO("Substituting into an existing buffer") {
+  GIVEN("a regex and a non-empty string") {
+    const Regex regex{"b+"};
+    openassetio::Str result = "prefix:";
+
+    WHEN("the substitution reduces the size") {
+      regex.substituteAndAppendTo("abbbcbb", "x", result);
+
+      THEN("the result is appended") { CHECK(result == "prefix:axcx"); }
+    }
+
+    WHEN("the substitution increases the size") {
+      regex.substituteAndAppendTo("abbbcbb", "yyyy", result);
+
+      THEN("the result is appended") { CHECK(result == "prefix:ayyyycyyyy"); }
+    }
+
+    WHEN("there is nothing to substitute") {
+      regex.substituteAndAppendTo("acd", "x", result);
+
+      THEN("the subject is appended") { CHECK(result == "prefix:acd"); }
+    }
+
+    WHEN("the subject is empty") {
+      regex.substituteAndAppendTo("", "x", result);
+
+      THEN("the string is unchanged") { CHECK(result == "prefix:"); }
+    }
+
+    WHEN("the string has sufficient capacity") {
+      result.reserve(100);
+      const char* const data = result.data();
+      regex.substituteAndAppendTo("abbbcbb", "yyyy", result);
+
+      THEN("the string is not reallocated") {
+        CHECK(result == "prefix:ayyyycyyyy");
+        CHECK(result.data() == data);
+      }
+    }
+  }
+
+  GIVEN("a regex and a memory buffer") {
+    const Regex regex{"b+"};
+    fmt::memory_buffer result;
+    result.append(std::string_view{"prefix:"});
+
+    WHEN("the substitution increases the size") {
+      regex.substituteAndAppendTo("abbbcbb", "yyyy", result);
+
+      THEN("the result is appended") { CHECK(fmt::to_string(result) == "prefix:ayyyycyyyy"); }
+    }
+  }
+
+  GIVEN("a regex that errors when matching") {
+    // Exceeds the match limit, see "Invalid match exception".
+    const Regex regex{"(*LIMIT_MATCH=1)((a+)b)+"};
+    openassetio::Str result = "prefix:";
+
+    WHEN("substituting") {
+      THEN("an exception is thrown and the string is unchanged") {
+        CHECK_THROWS_MATCHES(
+            regex.substituteAndAppendTo("abab", "x", result), InputValidationException,
+            ExceptionMessageMatcher{
+                "Error -47 substituting regex matches in 'abab' with 'x': match limit exceeded"});
+        CHECK(result == "prefix:");
+      }
+    }
+  }
+}
+
+TEST_CASE("Match data re-use") {
+  const Regex regex{"a(.)c"};
+  const openassetio::Str text{"abcde"};
+
+  SECTION("live matches have distinct buffers") {
+    const auto match1 = regex.match(text);
+    const auto match2 = regex.match(text);
+    REQUIRE(match1.has_value());
+    REQUIRE(match2.has_value());
+    // NOLINTBEGIN(*-unchecked-optional-access) - checked above.
+    CHECK(match1->data().get() != match2->data().get());
+    CHECK(match1->group(text, 1) == "b");
+    CHECK(match2->group(text, 1) == "b");
+    // NOLINTEND(*-unchecked-optional-access)
+  }
+
+  SECTION("buffers are re-used once matches are destroyed") {
+    const pcre2_match_data* firstData = nullptr;
+    {
+      const auto match = regex.match(text);
+      REQUIRE(match.has_value());
+      // NOLINTNEXTLINE(*-unchecked-optional-access) - checked above.
+      firstData = match->data().get();
+    }
+    const auto match = regex.match(text);
+    REQUIRE(match.has_value());
+    // NOLINTBEGIN(*-unchecked-optional-access) - checked above.
+    CHECK(match->data().get() == firstData);
+    CHECK(match->group(text, 1) == "b");
+    // NOLINTEND(*-unchecked-optional-access)
+  }
+
+  SECTION("buffers are shared between patterns with sufficient capacity") {
+    const Regex otherRegex{"(a)(.)(c)"};
+    const pcre2_match_data* firstData = nullptr;
+    {
+      const auto match = otherRegex.match(text);
+      REQUIRE(match.has_value());
+      // NOLINTNEXTLINE(*-unchecked-optional-access) - checked above.
+      firstData = match->data().get();
+    }
+    const auto match = regex.match(text);
+    REQUIRE(match.has_value());
+    // NOLINTBEGIN(*-unchecked-optional-access) - checked above.
+    CHECK(match->data().get() == firstData);
+    CHECK(match->group(text, 1) == "b");
+    // NOLINTEND(*-unchecked-optional-access)
+  }
+
+  SECTION("buffers are not shared between threads") {
+    const pcre2_match_data* mainThreadData = nullptr;
+    {
+      const auto match = regex.match(text);
+      REQUIRE(match.has_value());
+      // NOLINTNEXTLINE(*-unchecked-optional-access) - checked above.
+      mainThreadData = match->data().get();
+    }
+
+    const pcre2_match_data* otherThreadData = nullptr;
+    std::thread{[&] {
+      const auto match = regex.match(text);
+      // NOLINTNEXTLINE(*-unchecked-optional-access) - checked below.
+      otherThreadData = match ? match->data().get() : nullptr;
+    }}.join();
+
+    CHECK(otherThreadData != nullptr);
+    CHECK(otherThreadData != mainThreadData);
+  }
+}
+
+TEST_CASE("Concurrent matching with a shared regex") {
+  constexpr std::size_t kNumThreads = 8;
+  constexpr std::size_t kNumIterations = 1000;
+  const Regex regex{"^(\\w+)-(\\d+)$"};
+
+  std::vector<std::size_t> numFailures(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+
+  for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+    threads.emplace_back([&, threadIdx] {
+      for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+        const openassetio::Str name = fmt::format("thread{}", threadIdx);
+        const openassetio::Str number = fmt::format("{}", iteration);
+        const openassetio::Str subject = fmt::format("{}-{}", name, number);
+
+        const auto match = regex.match(subject);
+        if (!match || match->group(subject, 1) != name || match->group(subject, 2) != number ||
+            regex.substituteToReduceSize(subject, "x") != "x") {
+          ++numFailures[threadIdx];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(numFailures == std::vector<std::size_t>(kNumThreads, 0));
+}
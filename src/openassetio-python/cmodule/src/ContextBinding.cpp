@@ -11,14 +11,17 @@
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/utils/ostream.hpp>
 
+#include "PyObjectCriticalSection.hpp"
 #include "PyRetainingSharedPtr.hpp"
 #include "_openassetio.hpp"
 
 void registerContext(const py::module& mod) {
   using openassetio::Context;
   using openassetio::ContextPtr;
+  using openassetio::PyObjectCriticalSection;
   using openassetio::managerApi::ManagerStateBasePtr;
   using openassetio::trait::TraitsData;
+  using openassetio::trait::TraitsDataPtr;
   using PyRetainingTraitsDataPtr = openassetio::PyRetainingSharedPtr<TraitsData>;
   using PyRetainingManagerStateBasePtr =
       openassetio::PyRetainingSharedPtr<openassetio::managerApi::ManagerStateBase>;
@@ -39,14 +42,32 @@ void registerContext(const py::module& mod) {
       .def(py::init([] { return Context::make(TraitsData::make(), ManagerStateBasePtr{}); }))
       .def("__str__",
            [](const Context& self) {
+             const PyObjectCriticalSection lock{&self};
              std::ostringstream stringStream;
              stringStream << self;
              return stringStream.str();
            })
-      .def_readwrite("locale", &Context::locale)
+      // Members are accessed under lock, since assigning a shared_ptr
+      // whilst another thread copies it is a data race in free-threaded
+      // Python builds.
       .def_property(
-          "managerState", [](const Context& self) { return self.managerState; },
+          "locale",
+          [](const Context& self) {
+            const PyObjectCriticalSection lock{&self};
+            return self.locale;
+          },
+          [](Context& self, TraitsDataPtr locale) {
+            const PyObjectCriticalSection lock{&self};
+            self.locale = std::move(locale);
+          })
+      .def_property(
+          "managerState",
+          [](const Context& self) {
+            const PyObjectCriticalSection lock{&self};
+            return self.managerState;
+          },
           [](Context& self, PyRetainingManagerStateBasePtr managerState) {
+            const PyObjectCriticalSection lock{&self};
             self.managerState = std::move(managerState);
           });
 }
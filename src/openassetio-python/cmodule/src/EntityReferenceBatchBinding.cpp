@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "PyEntityReferenceBatch.hpp"
+#include "_openassetio.hpp"
+
+void registerEntityReferenceBatch(const py::module& mod) {
+  using openassetio::EntityReference;
+  using openassetio::EntityReferences;
+  using openassetio::PyEntityReferenceBatch;
+  using openassetio::Str;
+
+  py::class_<PyEntityReferenceBatch>{mod, "EntityReferenceBatch", py::is_final()}
+      .def(py::init<EntityReferences>(), py::arg("entityReferences"))
+      .def_static(
+          "fromStrings",
+          [](const std::vector<Str>& entityReferenceStrings) {
+            EntityReferences entityReferences;
+            entityReferences.reserve(entityReferenceStrings.size());
+            for (const Str& entityReferenceString : entityReferenceStrings) {
+              entityReferences.emplace_back(entityReferenceString);
+            }
+            return PyEntityReferenceBatch{std::move(entityReferences)};
+          },
+          py::arg("entityReferenceStrings"))
+      .def("__len__",
+           [](const PyEntityReferenceBatch& self) { return self.entityReferences().size(); })
+      .def("__getitem__",
+           [](const PyEntityReferenceBatch& self, const py::ssize_t index) {
+             const auto size = static_cast<py::ssize_t>(self.entityReferences().size());
+             const py::ssize_t wrappedIndex = index < 0 ? index + size : index;
+             if (wrappedIndex < 0 || wrappedIndex >= size) {
+               throw py::index_error{"EntityReferenceBatch index out of range"};
+             }
+             return self.entityReferences()[static_cast<std::size_t>(wrappedIndex)];
+           })
+      .def(
+          "__iter__",
+          [](const PyEntityReferenceBatch& self) {
+            return py::make_iterator(self.entityReferences().begin(),
+                                     self.entityReferences().end());
+          },
+          py::keep_alive<0, 1>())
+      .def(
+          "__eq__",
+          [](const PyEntityReferenceBatch& self, const PyEntityReferenceBatch& other) {
+            return self.entityReferences() == other.entityReferences();
+          },
+          py::is_operator())
+      .def("__repr__",
+           [](const PyEntityReferenceBatch& self) {
+             return fmt::format("EntityReferenceBatch(<{} entity references>)",
+                                self.entityReferences().size());
+           })
+      .def("toStrings", [](const PyEntityReferenceBatch& self) {
+        std::vector<Str> entityReferenceStrings;
+        entityReferenceStrings.reserve(self.entityReferences().size());
+        for (const EntityReference& entityReference : self.entityReferences()) {
+          entityReferenceStrings.push_back(entityReference.toString());
+        }
+        return entityReferenceStrings;
+      });
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines PyBatchCallback, the type of the per-element callbacks given
+ * to Python implementations of batch methods.
+ */
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Callable wrapper for a C++ per-element batch callback, for passing to
+ * Python.
+ *
+ * As well as being callable per element, the wrapper provides a
+ * `many(indices, values)` method, so that a Python implementation can
+ * deliver results for many elements in a single call. Converting
+ * arguments and dispatching from Python to C++ is then paid once per
+ * batch rather than once per element.
+ *
+ * @tparam Value Type of the callback's second (per-element result)
+ * argument.
+ */
+template <class Value>
+class PyBatchCallback {
+ public:
+  using Callback = std::function<void(std::size_t, Value)>;
+
+  explicit PyBatchCallback(Callback callback) : callback_{std::move(callback)} {}
+
+  /// Call the wrapped callback for a single element.
+  void operator()(const std::size_t index, Value value) const {
+    callback_(index, std::move(value));
+  }
+
+  /**
+   * Call the wrapped callback for each index/value pair in turn.
+   *
+   * @throws errors.InputValidationException if the number of indices
+   * and values differ. No elements are delivered in that case.
+   */
+  void many(const std::vector<std::size_t>& indices, std::vector<Value> values) const {
+    if (indices.size() != values.size()) {
+      throw errors::InputValidationException{
+          fmt::format("Number of indices ({}) does not match number of values ({})",
+                      indices.size(), values.size())};
+    }
+    for (std::size_t idx = 0; idx < indices.size(); ++idx) {
+      callback_(indices[idx], std::move(values[idx]));
+    }
+  }
+
+  /// Register this instantiation as a Python class.
+  static void registerClass(const pybind11::handle& scope, const char* name) {
+    namespace py = pybind11;
+    py::class_<PyBatchCallback>(scope, name, py::is_final())
+        .def("__call__", &PyBatchCallback::operator(), py::arg("index"), py::arg("value"))
+        .def("many", &PyBatchCallback::many, py::arg("indices"), py::arg("values"));
+  }
+
+ private:
+  Callback callback_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
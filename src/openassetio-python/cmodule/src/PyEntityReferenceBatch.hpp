@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines PyEntityReferenceBatch, and a pybind11 type caster for
+ * EntityReferences that accepts it without copying.
+ */
+#include <cstddef>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Immutable batch of entity references, exposed to Python as
+ * `EntityReferenceBatch`.
+ *
+ * Passing a Python list of entity references to a batch method
+ * converts every element, one at a time, into a new C++ vector. A
+ * batch holds its entity references in the C++ vector directly, so
+ * can be passed to any number of batch method calls without
+ * conversion.
+ *
+ * The batch cannot be modified once constructed, so it is safe to
+ * reference its contents from C++ whilst the GIL is released.
+ */
+class PyEntityReferenceBatch {
+ public:
+  explicit PyEntityReferenceBatch(EntityReferences entityReferences)
+      : entityReferences_{std::move(entityReferences)} {}
+
+  [[nodiscard]] const EntityReferences& entityReferences() const { return entityReferences_; }
+
+ private:
+  EntityReferences entityReferences_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+namespace pybind11::detail {
+/**
+ * Type caster for EntityReferences, i.e. a list of EntityReference.
+ *
+ * When converting from Python, an `EntityReferenceBatch` is
+ * referenced directly, rather than copied. Any other sequence is
+ * converted element-wise, as per pybind11's default list caster.
+ *
+ * Conversion to Python is unchanged, i.e. creates a `list`.
+ *
+ * @warning This caster must be visible wherever EntityReferences are
+ * converted, hence is included via _openassetio.hpp.
+ */
+template <>
+class type_caster<openassetio::EntityReferences> {
+  using EntityReferences = openassetio::EntityReferences;
+  using ListCaster = list_caster<EntityReferences, openassetio::EntityReference>;
+
+ public:
+  static constexpr auto name = const_name("List[") +
+                               make_caster<openassetio::EntityReference>::name +
+                               const_name("]");
+
+  template <class T>
+  using cast_op_type = const EntityReferences&;
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator const EntityReferences&() {
+    if (entityReferences_ != nullptr) {
+      return *entityReferences_;
+    }
+    return static_cast<EntityReferences&>(listCaster_);
+  }
+
+  bool load(const handle src, const bool convert) {
+    make_caster<openassetio::PyEntityReferenceBatch> batchCaster;
+    if (batchCaster.load(src, /* convert= */ false)) {
+      entityReferences_ =
+          &cast_op<const openassetio::PyEntityReferenceBatch&>(batchCaster).entityReferences();
+      return true;
+    }
+    entityReferences_ = nullptr;
+    return listCaster_.load(src, convert);
+  }
+
+  template <class T>
+  static handle cast(T&& src, const return_value_policy policy, const handle parent) {
+    return ListCaster::cast(std::forward<T>(src), policy, parent);
+  }
+
+ private:
+  /// Contents of a batch, or nullptr if converted by listCaster_.
+  const EntityReferences* entityReferences_{nullptr};
+  ListCaster listCaster_;
+};
+}  // namespace pybind11::detail
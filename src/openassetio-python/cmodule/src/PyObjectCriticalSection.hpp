@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines PyObjectCriticalSection, a per-object lock for free-threaded
+ * (no-GIL) Python builds.
+ */
+#include <typeinfo>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * RAII lock of one or two Python objects, equivalent to CPython's
+ * `Py_BEGIN_CRITICAL_SECTION`/`Py_END_CRITICAL_SECTION`.
+ *
+ * With the GIL, bound methods of an object cannot run concurrently
+ * with each other, which the bindings of classes with mutable state
+ * (e.g. `TraitsData`) rely upon. Free-threaded builds have no GIL, so
+ * such methods must instead lock the Python object wrapping the
+ * instance, in the same way as CPython's built-in types.
+ *
+ * Unlike a mutex, the lock is temporarily released if the thread
+ * blocks (e.g. waits to acquire another lock, or calls back into
+ * Python), so cannot deadlock. As such, it guarantees atomicity only
+ * for sections that do not block.
+ *
+ * A no-op in builds with a GIL.
+ *
+ * Must be constructed with the calling thread attached to the Python
+ * interpreter (i.e. "holding the GIL").
+ */
+class PyObjectCriticalSection {
+ public:
+  /// Lock a Python object. A null handle is not locked.
+  explicit PyObjectCriticalSection([[maybe_unused]] const pybind11::handle obj) {
+#ifdef Py_GIL_DISABLED
+    begin(obj, pybind11::handle{});
+#endif
+  }
+
+  /**
+   * Lock two Python objects, e.g. both operands of a comparison. Null
+   * handles are not locked.
+   */
+  PyObjectCriticalSection([[maybe_unused]] const pybind11::handle obj1,
+                          [[maybe_unused]] const pybind11::handle obj2) {
+#ifdef Py_GIL_DISABLED
+    begin(obj1, obj2);
+#endif
+  }
+
+  /**
+   * Lock the Python object wrapping an instance of a bound C++ class.
+   *
+   * The instance is not locked if it has no Python object, e.g. if
+   * created in C++ and not yet passed to Python.
+   */
+  template <class Class>
+  explicit PyObjectCriticalSection([[maybe_unused]] const Class* instance)
+#ifdef Py_GIL_DISABLED
+      : PyObjectCriticalSection{pyInstanceOf(instance)}
+#endif
+  {
+  }
+
+  /// Lock the Python objects wrapping two instances of bound classes.
+  template <class Class1, class Class2>
+  PyObjectCriticalSection([[maybe_unused]] const Class1* instance1,
+                          [[maybe_unused]] const Class2* instance2)
+#ifdef Py_GIL_DISABLED
+      : PyObjectCriticalSection{pyInstanceOf(instance1), pyInstanceOf(instance2)}
+#endif
+  {
+  }
+
+  ~PyObjectCriticalSection() {
+#ifdef Py_GIL_DISABLED
+    if (numLocked_ == 2) {
+      PyCriticalSection2_End(&criticalSection2_);
+    } else if (numLocked_ == 1) {
+      PyCriticalSection_End(&criticalSection_);
+    }
+#endif
+  }
+
+  PyObjectCriticalSection(const PyObjectCriticalSection&) = delete;
+  PyObjectCriticalSection(PyObjectCriticalSection&&) noexcept = delete;
+  PyObjectCriticalSection& operator=(const PyObjectCriticalSection&) = delete;
+  PyObjectCriticalSection& operator=(PyObjectCriticalSection&&) noexcept = delete;
+
+ private:
+#ifdef Py_GIL_DISABLED
+  template <class Class>
+  static pybind11::handle pyInstanceOf(const Class* instance) {
+    static const pybind11::detail::type_info* const kTypeInfo =
+        pybind11::detail::get_type_info(typeid(Class));
+    if (instance == nullptr) {
+      return {};
+    }
+    return pybind11::detail::get_object_handle(instance, kTypeInfo);
+  }
+
+  void begin(pybind11::handle obj1, pybind11::handle obj2) {
+    if (!obj1) {
+      std::swap(obj1, obj2);
+    }
+    if (obj2 && obj2.ptr() != obj1.ptr()) {
+      PyCriticalSection2_Begin(&criticalSection2_, obj1.ptr(), obj2.ptr());
+      numLocked_ = 2;
+    } else if (obj1) {
+      PyCriticalSection_Begin(&criticalSection_, obj1.ptr());
+      numLocked_ = 1;
+    }
+  }
+
+  PyCriticalSection criticalSection_{};
+  PyCriticalSection2 criticalSection2_{};
+  int numLocked_{0};
+#endif
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines PyOverrideCache, a per-instance cache of the Python methods
+ * that override the virtual methods of a pybind11 trampoline class.
+ */
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+
+#include "PyObjectCriticalSection.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Python override of a virtual method, as found by PyOverrideCache.
+ *
+ * Evaluates to false if the method is not overridden in Python.
+ */
+class PyOverride {
+ public:
+  explicit operator bool() const { return static_cast<bool>(function_); }
+
+  /// Call the override with the given (C++) arguments.
+  template <class... Args>
+  pybind11::object operator()(Args&&... args) const {
+    if (isBound_) {
+      return function_(std::forward<Args>(args)...);
+    }
+    return function_(self_, std::forward<Args>(args)...);
+  }
+
+ private:
+  friend class PyOverrideCache;
+
+  /// Bound method, or unbound function if isBound_ is false.
+  pybind11::object function_;
+  pybind11::handle self_;
+  bool isBound_{true};
+};
+
+/**
+ * Cache of the Python methods overriding a trampoline's virtual
+ * methods, for use in place of `pybind11::get_override`.
+ *
+ * `pybind11::get_override` looks up the method by name on the Python
+ * instance for every call, creating a bound method each time. For
+ * small, frequently called methods this can dominate the cost of the
+ * call. Instead, the plain function found on the Python type is cached
+ * on first use, and called with the instance as its first argument.
+ *
+ * A cached entry is used only whilst:
+ * - The instance's type is unchanged (`__class__` can be reassigned).
+ * - The type's version tag is unchanged. CPython resets the tag
+ *   whenever the type or any of its bases is modified, e.g. by
+ *   assigning a method to the class.
+ * - The instance has no attribute of the same name in its `__dict__`,
+ *   which would otherwise shadow the method.
+ * - The caller is not a Python method of the same name, i.e. the
+ *   override is not calling its base class implementation via
+ *   `super()`. In that case pybind11 deliberately finds no override,
+ *   to avoid infinite recursion.
+ *
+ * Otherwise the lookup falls back to `pybind11::get_override`, and the
+ * cache is refreshed where possible.
+ *
+ * Must only be used with the GIL held. In free-threaded builds, the
+ * cache is locked via the Python instance, so concurrent calls to the
+ * same instance are safe. The override itself is called unlocked.
+ */
+class PyOverrideCache {
+ public:
+  PyOverrideCache() = default;
+
+  /// Release cached functions, acquiring the GIL if necessary.
+  ~PyOverrideCache() {
+    if (!entries_.empty() && Py_IsInitialized() != 0) {
+      const pybind11::gil_scoped_acquire gil{};
+      entries_.clear();
+    }
+  }
+
+  PyOverrideCache(const PyOverrideCache&) = delete;
+  PyOverrideCache(PyOverrideCache&&) noexcept = delete;
+  PyOverrideCache& operator=(const PyOverrideCache&) = delete;
+  PyOverrideCache& operator=(PyOverrideCache&&) noexcept = delete;
+
+  /**
+   * Get the Python override of a method of the given trampoline
+   * instance.
+   *
+   * @param self C++ instance, as given to `pybind11::get_override`.
+   * @param name Name of the method. Must have static storage duration.
+   */
+  template <class Class>
+  PyOverride get(const Class* self, const char* name) {
+    static const pybind11::detail::type_info* const kTypeInfo =
+        pybind11::detail::get_type_info(typeid(Class));
+    const pybind11::handle pySelf = pybind11::detail::get_object_handle(self, kTypeInfo);
+    if (!pySelf) {
+      return {};
+    }
+    const PyObjectCriticalSection lock{pySelf};
+    Entry& entry = entryFor(name);
+    if (isValid(entry, pySelf)) {
+      PyOverride override;
+      if (entry.function) {
+        override.function_ = entry.function;
+        override.self_ = pySelf;
+        override.isBound_ = false;
+      }
+      return override;
+    }
+
+    PyOverride override;
+    override.function_ = pybind11::get_override(self, name);
+    refresh(entry, pySelf, override.function_);
+    return override;
+  }
+
+ private:
+  struct Entry {
+    /// Interned method name.
+    pybind11::str name;
+    /// Type the function was found on, or nullptr if invalid.
+    PyTypeObject* type{nullptr};
+    unsigned int versionTag{0};
+    /// Unbound override, or null if not overridden.
+    pybind11::object function;
+  };
+
+  Entry& entryFor(const char* name) {
+    Entry& entry = entries_[std::string_view{name}];
+    if (!entry.name) {
+      entry.name = pybind11::reinterpret_steal<pybind11::str>(PyUnicode_InternFromString(name));
+    }
+    return entry;
+  }
+
+  static bool isValid(const Entry& entry, const pybind11::handle pySelf) {
+    PyTypeObject* type = Py_TYPE(pySelf.ptr());
+    return entry.type == type && type->tp_version_tag == entry.versionTag &&
+           !hasInstanceAttribute(pySelf, entry.name) && !isCalledFromMethod(entry.name);
+  }
+
+  static void refresh(Entry& entry, const pybind11::handle pySelf,
+                      const pybind11::object& boundOverride) {
+    if (isCalledFromMethod(entry.name)) {
+      // Base class implementation called via super(), so leave the
+      // cached override in place for subsequent calls.
+      return;
+    }
+    entry.type = nullptr;
+    entry.function = pybind11::object{};
+
+    if (hasInstanceAttribute(pySelf, entry.name)) {
+      return;
+    }
+    pybind11::object function;
+    if (boundOverride) {
+      // Only plain functions found on the type can be called unbound.
+      PyObject* method = boundOverride.ptr();
+      if (!PyMethod_Check(method) || PyMethod_GET_SELF(method) != pySelf.ptr() ||
+          !PyFunction_Check(PyMethod_GET_FUNCTION(method))) {
+        return;
+      }
+      function = pybind11::reinterpret_borrow<pybind11::object>(PyMethod_GET_FUNCTION(method));
+    }
+    // Zero if the type has been modified since it was last looked up.
+    PyTypeObject* type = Py_TYPE(pySelf.ptr());
+    if (type->tp_version_tag == 0) {
+      return;
+    }
+    entry.type = type;
+    entry.versionTag = type->tp_version_tag;
+    entry.function = std::move(function);
+  }
+
+  static bool hasInstanceAttribute(const pybind11::handle pySelf, const pybind11::str& name) {
+    PyObject* dict = PyObject_GenericGetDict(pySelf.ptr(), nullptr);
+    if (dict == nullptr) {
+      // No __dict__, e.g. due to __slots__.
+      PyErr_Clear();
+      return false;
+    }
+    const int contains = PyDict_Contains(dict, name.ptr());
+    Py_DECREF(dict);
+    if (contains < 0) {
+      throw pybind11::error_already_set{};
+    }
+    return contains == 1;
+  }
+
+  static bool isCalledFromMethod(const pybind11::str& name) {
+    PyFrameObject* frame = PyEval_GetFrame();
+    if (frame == nullptr) {
+      return false;
+    }
+    PyCodeObject* code = PyFrame_GetCode(frame);
+    const bool isSameName =
+        code->co_name == name.ptr() || PyUnicode_Compare(code->co_name, name.ptr()) == 0;
+    Py_DECREF(code);
+    return isSameName;
+  }
+
+  std::unordered_map<std::string_view, Entry> entries_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
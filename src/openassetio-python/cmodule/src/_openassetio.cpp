@@ -11,8 +11,19 @@
 extern void registerTestUtils(py::module& mod);
 #endif
 
+#ifdef Py_GIL_DISABLED
+#if PYBIND11_VERSION_HEX < 0x020D0000
+#error "Free-threaded (no-GIL) Python builds require pybind11 2.13 or later"
+#endif
+// Declare that the module is safe to use without the GIL, otherwise
+// importing it would re-enable the GIL for the whole process. Objects
+// with mutable state lock themselves, see PyObjectCriticalSection.
+// NOLINTNEXTLINE
+PYBIND11_MODULE(_openassetio, mod, py::mod_gil_not_used()) {
+#else
 // NOLINTNEXTLINE
 PYBIND11_MODULE(_openassetio, mod) {
+#endif
   namespace py = pybind11;
 
   // Note: the `register` functions here should be called in dependency
@@ -37,12 +48,14 @@ PYBIND11_MODULE(_openassetio, mod) {
   registerLoggerInterface(log);
   registerConsoleLogger(log);
   registerSeverityFilter(log);
+  registerDuplicateFilter(log);
   registerTraitsData(trait);
   registerManagerStateBase(managerApi);
   registerContext(mod);
   registerBatchElementError(errors);
   registerExceptions(errors);
   registerEntityReference(mod);
+  registerEntityReferenceBatch(mod);
   registerHostInterface(hostApi);
   registerHost(managerApi);
   registerHostSession(managerApi);
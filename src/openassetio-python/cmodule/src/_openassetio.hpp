@@ -11,6 +11,7 @@
 
 #include <openassetio/typedefs.hpp>
 
+#include "PyEntityReferenceBatch.hpp"
 #include "PyRetainingSharedPtr.hpp"
 
 OPENASSETIO_FWD_DECLARE(ManagerStateBase)
@@ -69,6 +70,9 @@ void registerConsoleLogger(const py::module& mod);
 /// Register the SeverityFilter class with Python.
 void registerSeverityFilter(const py::module& mod);
 
+/// Register the DuplicateFilter class with Python.
+void registerDuplicateFilter(const py::module& mod);
+
 /// Register the Context class with Python.
 void registerContext(const py::module& mod);
 
@@ -102,6 +106,9 @@ void registerManagerStateBase(const py::module& mod);
 /// Register the EntityReference type with Python.
 void registerEntityReference(const py::module& mod);
 
+/// Register the EntityReferenceBatch type with Python.
+void registerEntityReferenceBatch(const py::module& mod);
+
 /// Register the BatchElementError type with Python.
 void registerBatchElementError(const py::module& mod);
 
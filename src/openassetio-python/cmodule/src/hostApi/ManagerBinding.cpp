@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <optional>
+#include <utility>
 #include <vector>
 
+#include <fmt/core.h>
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
@@ -18,6 +21,7 @@
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
 
 #include "../_openassetio.hpp"
 
@@ -44,6 +48,95 @@ py::list pyBoolListFromUintVector(const std::vector<Manager::BoolAsUint>& boolAs
   }
   return pyResult;
 }
+
+/// List of (trait ID, property key) pairs to extract from results.
+using TraitPropertyKeys = std::vector<std::pair<trait::TraitId, trait::property::Key>>;
+
+/**
+ * Resolve a batch of entity references, extracting only the requested
+ * trait properties.
+ *
+ * Returns one Python list per requested property, each with one
+ * element per entity reference. An element is the property value, or
+ * `None` if the resolved entity has no such property, or the
+ * BatchElementError if the entity failed to resolve.
+ *
+ * Property values are gathered into C++ storage from within the
+ * success callback, so no Python objects are created per entity
+ * until the output lists are built, in a single pass, after the
+ * manager call. The GIL must be released by the caller; it is
+ * acquired only to build the output lists.
+ */
+py::list resolveProperties(Manager& manager, const EntityReferences& entityReferences,
+                           const TraitPropertyKeys& traitPropertyKeys,
+                           const openassetio::access::ResolveAccess resolveAccess,
+                           const openassetio::ContextConstPtr& context) {
+  using openassetio::errors::BatchElementError;
+  using MaybeValue = std::optional<trait::property::Value>;
+
+  const std::size_t numEntities = entityReferences.size();
+  const std::size_t numProperties = traitPropertyKeys.size();
+
+  const auto validateIndex = [numEntities](const std::size_t idx) {
+    if (idx >= numEntities) {
+      throw openassetio::errors::InputValidationException{
+          fmt::format("Index '{}' out of bounds for batch size of {}", idx, numEntities)};
+    }
+  };
+
+  trait::TraitSet traitSet;
+  for (const auto& [traitId, propertyKey] : traitPropertyKeys) {
+    traitSet.insert(traitId);
+  }
+
+  // Column-major, i.e. all values of the first property, then all
+  // values of the second property, etc.
+  std::vector<MaybeValue> values(numProperties * numEntities);
+  std::vector<std::optional<BatchElementError>> errors(numEntities);
+
+  manager.resolve(
+      entityReferences, traitSet, resolveAccess, context,
+      [&](const std::size_t idx, const trait::TraitsDataPtr& traitsData) {
+        validateIndex(idx);
+        trait::property::Value value;
+        for (std::size_t propIdx = 0; propIdx < numProperties; ++propIdx) {
+          const auto& [traitId, propertyKey] = traitPropertyKeys[propIdx];
+          if (traitsData->getTraitProperty(&value, traitId, propertyKey)) {
+            values[propIdx * numEntities + idx] = std::move(value);
+          }
+        }
+      },
+      [&](const std::size_t idx, BatchElementError error) {
+        validateIndex(idx);
+        errors[idx] = std::move(error);
+      });
+
+  const py::gil_scoped_acquire gil{};
+
+  // Convert each error once, sharing it between all columns.
+  std::vector<py::object> pyErrors(numEntities);
+  for (std::size_t idx = 0; idx < numEntities; ++idx) {
+    if (errors[idx]) {
+      pyErrors[idx] = py::cast(std::move(*errors[idx]));
+    }
+  }
+
+  py::list columns{numProperties};
+  for (std::size_t propIdx = 0; propIdx < numProperties; ++propIdx) {
+    py::list column{numEntities};
+    for (std::size_t idx = 0; idx < numEntities; ++idx) {
+      if (pyErrors[idx]) {
+        column[idx] = pyErrors[idx];
+      } else if (const MaybeValue& value = values[propIdx * numEntities + idx]) {
+        column[idx] = py::cast(*value);
+      } else {
+        column[idx] = py::none();
+      }
+    }
+    columns[propIdx] = std::move(column);
+  }
+  return columns;
+}
 }  // namespace
 
 void registerManager(const py::module& mod) {
@@ -355,6 +448,9 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def("resolveProperties", &resolveProperties, py::arg("entityReferences"),
+           py::arg("traitPropertyKeys"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("getWithRelationship",
            py::overload_cast<const EntityReferences&, const trait::TraitsDataPtr&, std::size_t,
                              access::RelationsAccess, const ContextConstPtr&,
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+
+#include <openassetio/log/DuplicateFilter.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerDuplicateFilter(const py::module& mod) {
+  using openassetio::log::DuplicateFilter;
+  using openassetio::log::DuplicateFilterPtr;
+  using openassetio::log::LoggerInterface;
+
+  py::class_<DuplicateFilter, LoggerInterface, DuplicateFilterPtr>(mod, "DuplicateFilter",
+                                                                   py::is_final())
+      .def(py::init(RetainCommonPyArgs::forFn<&DuplicateFilter::make>()),
+           py::arg("upstreamLogger").none(false),
+           py::arg("window") = DuplicateFilter::kDefaultWindow)
+      .def("upstreamLogger", &DuplicateFilter::upstreamLogger)
+      .def("window", &DuplicateFilter::window)
+      .def("flush", &DuplicateFilter::flush);
+}
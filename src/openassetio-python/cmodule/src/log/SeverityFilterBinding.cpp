@@ -18,5 +18,10 @@ void registerSeverityFilter(const py::module& mod) {
            py::arg("upstreamLogger").none(false))
       .def("getSeverity", &SeverityFilter::getSeverity)
       .def("setSeverity", &SeverityFilter::setSeverity, py::arg("severity"))
-      .def("upstreamLogger", &SeverityFilter::upstreamLogger);
+      .def("upstreamLogger", &SeverityFilter::upstreamLogger)
+      .def("sourceLogger", &SeverityFilter::sourceLogger, py::arg("source"))
+      .def("setSourceSeverity", &SeverityFilter::setSourceSeverity, py::arg("source"),
+           py::arg("severity"))
+      .def("getSourceSeverity", &SeverityFilter::getSourceSeverity, py::arg("source"))
+      .def("resetSourceSeverity", &SeverityFilter::resetSourceSeverity, py::arg("source"));
 }
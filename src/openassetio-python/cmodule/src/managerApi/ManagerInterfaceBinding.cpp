@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <cstddef>
+#include <optional>
 #include <utility>
 
 #include <pybind11/functional.h>
@@ -11,6 +12,7 @@
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
@@ -20,6 +22,7 @@
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../PyBatchCallback.hpp"
 #include "../PyRetainingSharedPtr.hpp"
 #include "../_openassetio.hpp"
 #include "../overrideMacros.hpp"
@@ -31,6 +34,14 @@ namespace managerApi {
 /**
  * Trampoline class required for pybind to bind pure virtual methods
  * and allow C++ -> Python calls via a C++ instance.
+ *
+ * Per-element callbacks of batch methods are wrapped in a
+ * PyBatchCallback, so that Python implementations can deliver results
+ * in bulk.
+ *
+ * Python overrides are looked up via a PyOverrideCache, avoiding the
+ * cost of a full attribute lookup (and bound method creation) for
+ * every call.
  */
 struct PyManagerInterface final : ManagerInterface {
   using ManagerInterface::ManagerInterface;
@@ -38,92 +49,104 @@ struct PyManagerInterface final : ManagerInterface {
   using PyRetainingManagerStateBasePtr = PyRetainingSharedPtr<ManagerStateBase>;
 
   [[nodiscard]] Identifier identifier() const override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(Identifier, ManagerInterface, identifier, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(overrideCache_, Identifier, ManagerInterface,
+                                              identifier, /* no args */);
   }
 
   [[nodiscard]] Str displayName() const override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(Str, ManagerInterface, displayName, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(overrideCache_, Str, ManagerInterface, displayName,
+                                              /* no args */);
   }
 
   [[nodiscard]] InfoDictionary info() override {
-    OPENASSETIO_PYBIND11_OVERRIDE(InfoDictionary, ManagerInterface, info, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, InfoDictionary, ManagerInterface, info,
+                                         /* no args */);
   }
 
   [[nodiscard]] InfoDictionary settings(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(InfoDictionary, ManagerInterface, settings, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, InfoDictionary, ManagerInterface,
+                                         settings, hostSession);
   }
 
   void initialize(InfoDictionary managerSettings, const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, initialize, std::move(managerSettings),
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, initialize,
+                                         std::move(managerSettings), hostSession);
   }
 
   void flushCaches(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, flushCaches, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, flushCaches,
+                                         hostSession);
   }
 
   [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
                                                     access::PolicyAccess policyAccess,
                                                     const ContextConstPtr& context,
                                                     const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(trait::TraitsDatas, ManagerInterface, managementPolicy,
-                                  traitSets, policyAccess, context, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, trait::TraitsDatas, ManagerInterface,
+                                         managementPolicy, traitSets, policyAccess, context,
+                                         hostSession);
   }
 
   ManagerStateBasePtr createState(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface, createState,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, PyRetainingManagerStateBasePtr,
+                                         ManagerInterface, createState, hostSession);
   }
 
   ManagerStateBasePtr createChildState(const ManagerStateBasePtr& parentState,
                                        const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
-                                  createChildState, parentState, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, PyRetainingManagerStateBasePtr,
+                                         ManagerInterface, createChildState, parentState,
+                                         hostSession);
   }
 
   Str persistenceTokenForState(const ManagerStateBasePtr& parentState,
                                const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(Str, ManagerInterface, persistenceTokenForState, parentState,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, Str, ManagerInterface,
+                                         persistenceTokenForState, parentState, hostSession);
   }
 
   ManagerStateBasePtr stateFromPersistenceToken(const Str& token,
                                                 const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
-                                  stateFromPersistenceToken, token, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, PyRetainingManagerStateBasePtr,
+                                         ManagerInterface, stateFromPersistenceToken, token,
+                                         hostSession);
   }
 
   [[nodiscard]] bool isEntityReferenceString(const Str& someString,
                                              const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(bool, ManagerInterface, isEntityReferenceString, someString,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, bool, ManagerInterface,
+                                         isEntityReferenceString, someString, hostSession);
   }
 
   void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
                     const HostSessionPtr& hostSession,
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityExists, entityReferences, context,
-                                  hostSession, successCallback, errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, entityExists,
+                                         entityReferences, context, hostSession,
+                                         PyBatchCallback{successCallback},
+                                         PyBatchCallback{errorCallback});
   }
 
   [[nodiscard]] bool hasCapability(Capability capability) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(bool, ManagerInterface, hasCapability, capability);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(overrideCache_, bool, ManagerInterface,
+                                              hasCapability, capability);
   }
 
   [[nodiscard]] StrMap updateTerminology(StrMap terms,
                                          const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(StrMap, ManagerInterface, updateTerminology, std::move(terms),
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, StrMap, ManagerInterface,
+                                         updateTerminology, std::move(terms), hostSession);
   }
 
   void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
                const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
                const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
                const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, resolve, entityReferences, traitSet,
-                                  resolveAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, resolve,
+                                         entityReferences, traitSet, resolveAccess, context,
+                                         hostSession, PyBatchCallback{successCallback},
+                                         PyBatchCallback{errorCallback});
   }
 
   void entityTraits(const EntityReferences& entityReferences,
@@ -131,9 +154,10 @@ struct PyManagerInterface final : ManagerInterface {
                     const ContextConstPtr& context, const HostSessionPtr& hostSession,
                     const EntityTraitsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityTraits, entityReferences,
-                                  entityTraitsAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, entityTraits,
+                                         entityReferences, entityTraitsAccess, context,
+                                         hostSession, PyBatchCallback{successCallback},
+                                         PyBatchCallback{errorCallback});
   }
 
   void defaultEntityReference(const trait::TraitSets& traitSets,
@@ -141,9 +165,10 @@ struct PyManagerInterface final : ManagerInterface {
                               const ContextConstPtr& context, const HostSessionPtr& hostSession,
                               const DefaultEntityReferenceSuccessCallback& successCallback,
                               const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, defaultEntityReference, traitSets,
-                                  defaultEntityAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface,
+                                         defaultEntityReference, traitSets, defaultEntityAccess,
+                                         context, hostSession, PyBatchCallback{successCallback},
+                                         PyBatchCallback{errorCallback});
   }
 
   void getWithRelationship(const EntityReferences& entityReferences,
@@ -153,12 +178,13 @@ struct PyManagerInterface final : ManagerInterface {
                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
                            const RelationshipQuerySuccessCallback& successCallback,
                            const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
-        void, ManagerInterface, getWithRelationship,
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(
+        overrideCache_, void, ManagerInterface, getWithRelationship,
         (entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
          context, hostSession, successCallback, errorCallback),
         entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
-        context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
+        context, hostSession, RetainCommonPyArgs::forFn(successCallback),
+        PyBatchCallback{errorCallback});
   }
 
   void getWithRelationships(const EntityReference& entityReference,
@@ -168,12 +194,13 @@ struct PyManagerInterface final : ManagerInterface {
                             const ContextConstPtr& context, const HostSessionPtr& hostSession,
                             const RelationshipQuerySuccessCallback& successCallback,
                             const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
-        void, ManagerInterface, getWithRelationships,
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(
+        overrideCache_, void, ManagerInterface, getWithRelationships,
         (entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
          context, hostSession, successCallback, errorCallback),
         entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
-        context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
+        context, hostSession, RetainCommonPyArgs::forFn(successCallback),
+        PyBatchCallback{errorCallback});
   }
 
   void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
@@ -181,22 +208,28 @@ struct PyManagerInterface final : ManagerInterface {
                  const HostSessionPtr& hostSession,
                  const PreflightSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, preflight, entityReferences, traitsHints,
-                                  publishingAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ManagerInterface, preflight,
+                                         entityReferences, traitsHints, publishingAccess, context,
+                                         hostSession, PyBatchCallback{successCallback},
+                                         PyBatchCallback{errorCallback});
   }
 
   void register_(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsDatas,
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession, const RegisterSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_NAME(void, ManagerInterface, "register", register_,
-                                       entityReferences, traitsDatas, publishingAccess, context,
-                                       hostSession, successCallback, errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(overrideCache_, void, ManagerInterface, "register",
+                                              register_, entityReferences, traitsDatas,
+                                              publishingAccess, context, hostSession,
+                                              PyBatchCallback{successCallback},
+                                              PyBatchCallback{errorCallback});
   }
 
   // Hoist protected members
   using ManagerInterface::createEntityReference;
+
+ private:
+  mutable PyOverrideCache overrideCache_;
 };
 
 }  // namespace managerApi
@@ -207,12 +240,15 @@ void registerManagerInterface(const py::module& mod) {
   using openassetio::ContextConstPtr;
   using openassetio::EntityReference;
   using openassetio::EntityReferences;
+  using openassetio::PyBatchCallback;
   using openassetio::managerApi::HostSessionPtr;
   using openassetio::managerApi::ManagerInterface;
   using openassetio::managerApi::ManagerInterfacePtr;
   using openassetio::managerApi::ManagerStateBasePtr;
   using openassetio::managerApi::PyManagerInterface;
   using openassetio::trait::TraitsDataPtr;
+  namespace errors = openassetio::errors;
+  namespace trait = openassetio::trait;
 
   py::class_<ManagerInterface, PyManagerInterface, ManagerInterfacePtr> pyManagerInterface(
       mod, "ManagerInterface");
@@ -232,6 +268,20 @@ void registerManagerInterface(const py::module& mod) {
 
   pyManagerInterface.attr("kCapabilityNames") = ManagerInterface::kCapabilityNames;
 
+  // Callbacks given to Python implementations of batch methods.
+  PyBatchCallback<errors::BatchElementError>::registerClass(pyManagerInterface,
+                                                            "BatchElementErrorCallback");
+  PyBatchCallback<bool>::registerClass(pyManagerInterface, "ExistsSuccessCallback");
+  PyBatchCallback<trait::TraitSet>::registerClass(pyManagerInterface,
+                                                  "EntityTraitsSuccessCallback");
+  PyBatchCallback<TraitsDataPtr>::registerClass(pyManagerInterface, "ResolveSuccessCallback");
+  PyBatchCallback<std::optional<EntityReference>>::registerClass(
+      pyManagerInterface, "DefaultEntityReferenceSuccessCallback");
+  // Preflight and register success callbacks have the same signature.
+  PyBatchCallback<EntityReference>::registerClass(pyManagerInterface, "PreflightSuccessCallback");
+  pyManagerInterface.attr("RegisterSuccessCallback") =
+      pyManagerInterface.attr("PreflightSuccessCallback");
+
   pyManagerInterface.def(py::init())
       .def("identifier", &ManagerInterface::identifier, py::call_guard<py::gil_scoped_release>{})
       .def("displayName", &ManagerInterface::displayName, py::call_guard<py::gil_scoped_release>{})
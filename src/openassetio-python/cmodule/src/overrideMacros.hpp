@@ -3,6 +3,7 @@
 #pragma once
 #include <pybind11/pybind11.h>
 
+#include "./PyOverrideCache.hpp"
 #include "./errors/exceptionsConverter.hpp"
 
 /// @note Update errorsTest.cpp if adding more override macros below.
@@ -83,3 +84,83 @@
 #define OPENASSETIO_PYBIND11_OVERRIDE_PURE(ret_type, cname, fn, ...)                              \
   OPENASSETIO_PYBIND11_OVERRIDE_PURE_NAME(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), #fn, fn, \
                                           __VA_ARGS__)
+
+/**
+ * Duplicate of PYBIND11_OVERRIDE_IMPL, but looking up the Python
+ * override via a PyOverrideCache, rather than
+ * `pybind11::get_override`.
+ *
+ * The cache must be a (typically `mutable`) member of the trampoline
+ * class.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(cache, ret_type, cname, name, ...)              \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                            \
+    const pybind11::gil_scoped_acquire gil{};                                                    \
+    const openassetio::PyOverride override = (cache).get(static_cast<const cname*>(this), name); \
+    if (override) {                                                                              \
+      auto o = override(__VA_ARGS__);                                                            \
+      if (pybind11::detail::cast_is_temporary_value_reference<ret_type>::value) {                \
+        static pybind11::detail::override_caster_t<ret_type> caster;                             \
+        return pybind11::detail::cast_ref<ret_type>(std::move(o), caster);                       \
+      }                                                                                          \
+      return pybind11::detail::cast_safe<ret_type>(std::move(o));                                \
+    }                                                                                            \
+  } while (false)
+
+/**
+ * As OPENASSETIO_PYBIND11_OVERRIDE_NAME, but looking up the Python
+ * override via a PyOverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(cache, ret_type, cname, name, fn, ...)  \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                     \
+    return decorateWithExceptionConverter([&]() -> decltype(cname::fn(__VA_ARGS__)) {     \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(cache, PYBIND11_TYPE(ret_type),           \
+                                                PYBIND11_TYPE(cname), name, __VA_ARGS__); \
+      return cname::fn(__VA_ARGS__);                                                      \
+    });                                                                                   \
+  } while (false)
+
+/**
+ * As OPENASSETIO_PYBIND11_OVERRIDE, but looking up the Python override
+ * via a PyOverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE(cache, ret_type, cname, fn, ...)                     \
+  OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(cache, PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), \
+                                            #fn, fn, __VA_ARGS__)
+
+/**
+ * As OPENASSETIO_PYBIND11_OVERRIDE_ARGS, but looking up the Python
+ * override via a PyOverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(cache, Ret, Class, Fn, CppArgs,                 \
+                                                  ... /* PyArgs */)                               \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                             \
+    return decorateWithExceptionConverter([&]() -> decltype(Class::Fn CppArgs) {                  \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(cache, PYBIND11_TYPE(Ret), PYBIND11_TYPE(Class),  \
+                                                #Fn, __VA_ARGS__);                                \
+      return Class::Fn CppArgs;                                                                   \
+    });                                                                                           \
+  } while (false)
+
+/**
+ * As OPENASSETIO_PYBIND11_OVERRIDE_PURE_NAME, but looking up the
+ * Python override via a PyOverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE_NAME(cache, ret_type, cname, name, fn, ...)  \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                          \
+    return decorateWithExceptionConverter([&]() -> decltype(cname::fn(__VA_ARGS__)) {          \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(cache, PYBIND11_TYPE(ret_type),                \
+                                                PYBIND11_TYPE(cname), name, __VA_ARGS__);      \
+      const pybind11::gil_scoped_acquire gil{};                                                \
+      pybind11::pybind11_fail(                                                                 \
+          "Tried to call pure virtual function \"" PYBIND11_STRINGIFY(cname) "::" name "\""); \
+    });                                                                                        \
+  } while (false)
+
+/**
+ * As OPENASSETIO_PYBIND11_OVERRIDE_PURE, but looking up the Python
+ * override via a PyOverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(cache, ret_type, cname, fn, ...)        \
+  OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE_NAME(cache, PYBIND11_TYPE(ret_type),          \
+                                                 PYBIND11_TYPE(cname), #fn, fn, __VA_ARGS__)
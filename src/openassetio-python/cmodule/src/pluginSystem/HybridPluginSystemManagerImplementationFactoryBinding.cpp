@@ -36,7 +36,7 @@ void registerHybridPluginSystemManagerImplementationFactory(const py::module_& m
              HybridPluginSystemManagerImplementationFactory::Ptr>(
       mod, "HybridPluginSystemManagerImplementationFactory", py::is_final())
       .def(py::init([](PyRetainingManagerImplFactoryPtrs factories,
-                       PyRetainingLoggerInterfacePtr logger) {
+                       PyRetainingLoggerInterfacePtr logger, const bool concurrentLifecycle) {
              if (any_of(cbegin(factories), cend(factories),
                         std::logical_not<PyRetainingManagerImplFactoryPtrs::value_type>{})) {
                throw openassetio::errors::InputValidationException{
@@ -45,9 +45,10 @@ void registerHybridPluginSystemManagerImplementationFactory(const py::module_& m
 
              return HybridPluginSystemManagerImplementationFactory::make(
                  {make_move_iterator(begin(factories)), make_move_iterator(end(factories))},
-                 std::move(logger));
+                 std::move(logger), concurrentLifecycle);
            }),
-           py::arg("factories"), py::arg("logger").none(false))
+           py::arg("factories"), py::arg("logger").none(false),
+           py::arg("concurrentLifecycle") = false)
       .def("identifiers", &HybridPluginSystemManagerImplementationFactory::identifiers,
            py::call_guard<py::gil_scoped_release>{})
       .def("instantiate", &HybridPluginSystemManagerImplementationFactory::instantiate,
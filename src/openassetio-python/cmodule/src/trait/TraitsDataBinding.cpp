@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <cstddef>
 #include <optional>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
-#include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/trait/TraitsData.hpp>
@@ -11,47 +14,150 @@
 #include <openassetio/trait/property.hpp>
 #include <openassetio/utils/ostream.hpp>
 
+#include "../PyObjectCriticalSection.hpp"
 #include "../_openassetio.hpp"
 
+namespace {
+using openassetio::PyObjectCriticalSection;
+using openassetio::trait::TraitsData;
+using openassetio::trait::TraitsDataPtr;
+namespace trait = openassetio::trait;
+namespace property = openassetio::trait::property;
+
+/// Nested mapping of trait ID -> property key -> property value.
+using TraitsDict =
+    std::unordered_map<trait::TraitId, std::unordered_map<property::Key, property::Value>>;
+
+/**
+ * Decorate a TraitsData member function such that the Python object
+ * wrapping the instance is locked for the duration of the call.
+ *
+ * Required for free-threaded Python builds, where there is no GIL to
+ * prevent concurrent calls on the same instance. A no-op otherwise.
+ */
+template <class Ret, class... Args>
+auto locked(Ret (TraitsData::*method)(Args...) const) {
+  return [method](const TraitsData& self, Args... args) -> Ret {
+    const PyObjectCriticalSection lock{&self};
+    return (self.*method)(std::forward<Args>(args)...);
+  };
+}
+
+template <class Ret, class... Args>
+auto locked(Ret (TraitsData::*method)(Args...)) {
+  return [method](TraitsData& self, Args... args) -> Ret {
+    const PyObjectCriticalSection lock{&self};
+    return (self.*method)(std::forward<Args>(args)...);
+  };
+}
+
+/**
+ * Convert all traits and properties of a TraitsData to a Python dict.
+ *
+ * The dict is built directly, rather than via an intermediate
+ * TraitsDict, to avoid copying every property value twice.
+ */
+py::dict toDict(const TraitsData& traitsData) {
+  const PyObjectCriticalSection lock{&traitsData};
+  py::dict traitsDict;
+  property::Value value;
+  for (const trait::TraitId& traitId : traitsData.traitSet()) {
+    py::dict propertiesDict;
+    for (const property::Key& propertyKey : traitsData.traitPropertyKeys(traitId)) {
+      traitsData.getTraitProperty(&value, traitId, propertyKey);
+      propertiesDict[py::str(propertyKey)] = py::cast(value);
+    }
+    traitsDict[py::str(traitId)] = std::move(propertiesDict);
+  }
+  return traitsDict;
+}
+
+/// Construct a TraitsData from a (converted) Python dict.
+TraitsDataPtr fromDict(const TraitsDict& traitsDict) {
+  TraitsDataPtr traitsData = TraitsData::make();
+  for (const auto& [traitId, properties] : traitsDict) {
+    traitsData->addTrait(traitId);
+    for (const auto& [propertyKey, propertyValue] : properties) {
+      traitsData->setTraitProperty(traitId, propertyKey, propertyValue);
+    }
+  }
+  return traitsData;
+}
+}  // namespace
+
 void registerTraitsData(const py::module& mod) {
-  using openassetio::trait::TraitsData;
   using openassetio::trait::TraitsDataConstPtr;
-  using openassetio::trait::TraitsDataPtr;
-  namespace trait = openassetio::trait;
-  namespace property = openassetio::trait::property;
   using MaybeValue = std::optional<property::Value>;
 
   py::class_<TraitsData, TraitsDataPtr>(mod, "TraitsData", py::is_final())
       .def(py::init(static_cast<TraitsDataPtr (*)()>(&TraitsData::make)))
       .def(py::init(static_cast<TraitsDataPtr (*)(const trait::TraitSet&)>(&TraitsData::make)),
            py::arg("traitSet"))
-      .def(py::init(static_cast<TraitsDataPtr (*)(const TraitsDataConstPtr&)>(&TraitsData::make)),
+      .def(py::init([](const TraitsDataConstPtr& other) {
+             const PyObjectCriticalSection lock{other.get()};
+             return TraitsData::make(other);
+           }),
            py::arg("other").none(false))
-      .def("traitSet", &TraitsData::traitSet)
-      .def("hasTrait", &TraitsData::hasTrait, py::arg("traitId"))
-      .def("addTrait", &TraitsData::addTrait, py::arg("traitId"))
-      .def("addTraits", &TraitsData::addTraits, py::arg("traitSet"))
-      .def("setTraitProperty", &TraitsData::setTraitProperty, py::arg("traitId"),
+      .def("traitSet", locked(&TraitsData::traitSet))
+      .def("hasTrait", locked(&TraitsData::hasTrait), py::arg("traitId"))
+      .def("addTrait", locked(&TraitsData::addTrait), py::arg("traitId"))
+      .def("addTraits", locked(&TraitsData::addTraits), py::arg("traitSet"))
+      .def("setTraitProperty", locked(&TraitsData::setTraitProperty), py::arg("traitId"),
            py::arg("propertyKey"), py::arg("propertyValue").none(false))
       .def(
           "getTraitProperty",
           [](const TraitsData& self, const trait::TraitId& traitId,
              const property::Key& propertyKey) -> MaybeValue {
+            const PyObjectCriticalSection lock{&self};
             if (property::Value out; self.getTraitProperty(&out, traitId, propertyKey)) {
               return out;
             }
             return {};
           },
           py::arg("traitId"), py::arg("propertyKey"))
-      .def("traitPropertyKeys", &TraitsData::traitPropertyKeys, py::arg("traitId"))
-      .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
+      .def("traitPropertyKeys", locked(&TraitsData::traitPropertyKeys), py::arg("traitId"))
+      .def("toDict", &toDict)
+      .def_static("fromDict", &fromDict, py::arg("traitsDict"))
+      .def_static(
+          "toDicts",
+          [](const std::vector<TraitsDataPtr>& traitsDatas) {
+            py::list traitsDicts{traitsDatas.size()};
+            for (std::size_t idx = 0; idx < traitsDatas.size(); ++idx) {
+              if (!traitsDatas[idx]) {
+                throw py::type_error{"TraitsData.toDicts: TraitsData cannot be None"};
+              }
+              traitsDicts[idx] = toDict(*traitsDatas[idx]);
+            }
+            return traitsDicts;
+          },
+          py::arg("traitsDatas"))
+      .def_static(
+          "fromDicts",
+          [](const std::vector<TraitsDict>& traitsDicts) {
+            std::vector<TraitsDataPtr> traitsDatas;
+            traitsDatas.reserve(traitsDicts.size());
+            for (const TraitsDict& traitsDict : traitsDicts) {
+              traitsDatas.push_back(fromDict(traitsDict));
+            }
+            return traitsDatas;
+          },
+          py::arg("traitsDicts"))
+      .def(
+          "__eq__",
+          [](const TraitsData& self, const TraitsData& other) {
+            const PyObjectCriticalSection lock{&self, &other};
+            return self == other;
+          },
+          py::is_operator())
       .def("__str__",
            [](const TraitsData& self) {
+             const PyObjectCriticalSection lock{&self};
              std::ostringstream stringStream;
              stringStream << self;
              return stringStream.str();
            })
       .def("__repr__", [](const TraitsData& self) {
+        const PyObjectCriticalSection lock{&self};
         std::ostringstream stringStream;
         stringStream << "TraitsData(" << self << ")";
         return stringStream.str();
@@ -1,27 +1,96 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/typedefs.hpp>
 #include <openassetio/utils/path.hpp>
 #include <openassetio/utils/substitute.hpp>
 
 #include "_openassetio.hpp"
 
+namespace {
+/// View a batch of (owned) strings, for the batch conversion overloads.
+std::vector<std::string_view> viewsOf(const std::vector<openassetio::Str> &strs) {
+  return {strs.begin(), strs.end()};
+}
+}  // namespace
+
 void registerUtils(py::module_ &mod) {
   namespace utils = openassetio::utils;
+  using openassetio::Str;
 
   py::enum_<utils::PathType>{mod, "PathType"}
       .value("kSystem", utils::PathType::kSystem)
       .value("kPOSIX", utils::PathType::kPOSIX)
       .value("kWindows", utils::PathType::kWindows);
 
-  py::class_<utils::FileUrlPathConverter>(mod, "FileUrlPathConverter")
-      .def(py::init())
-      .def("pathToUrl", &utils::FileUrlPathConverter::pathToUrl, py::arg("absolutePath"),
-           py::arg("pathType") = utils::PathType::kSystem)
-      .def("pathFromUrl", &utils::FileUrlPathConverter::pathFromUrl, py::arg("fileUrl"),
-           py::arg("pathType") = utils::PathType::kSystem);
+  py::class_<utils::FileUrlPathConverter> fileUrlPathConverter(mod, "FileUrlPathConverter");
+
+  py::class_<utils::FileUrlPathConverter::CacheStatistics>(fileUrlPathConverter, "CacheStatistics")
+      .def_readonly("hits", &utils::FileUrlPathConverter::CacheStatistics::hits)
+      .def_readonly("misses", &utils::FileUrlPathConverter::CacheStatistics::misses)
+      .def_readonly("size", &utils::FileUrlPathConverter::CacheStatistics::size)
+      .def_readonly("capacity", &utils::FileUrlPathConverter::CacheStatistics::capacity);
+
+  fileUrlPathConverter.def(py::init())
+      .def(py::init<std::size_t>(), py::arg("cacheCapacity"))
+      .def("pathToUrl",
+           py::overload_cast<std::string_view, utils::PathType>(
+               &utils::FileUrlPathConverter::pathToUrl, py::const_),
+           py::arg("absolutePath"), py::arg("pathType") = utils::PathType::kSystem,
+           py::call_guard<py::gil_scoped_release>{})
+      // Batch overloads take copies of the input strings, rather than
+      // views, since the GIL is released and the input list could be
+      // modified (freeing its elements) concurrently.
+      .def(
+          "pathToUrl",
+          [](const utils::FileUrlPathConverter &self, const std::vector<Str> &absolutePaths,
+             const utils::PathType pathType) {
+            std::vector<Str> fileUrls;
+            self.pathToUrl(viewsOf(absolutePaths), fileUrls, pathType);
+            return fileUrls;
+          },
+          py::arg("absolutePaths"), py::arg("pathType") = utils::PathType::kSystem,
+          py::call_guard<py::gil_scoped_release>{})
+      .def("pathFromUrl",
+           py::overload_cast<std::string_view, utils::PathType>(
+               &utils::FileUrlPathConverter::pathFromUrl, py::const_),
+           py::arg("fileUrl"), py::arg("pathType") = utils::PathType::kSystem,
+           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "pathFromUrl",
+          [](const utils::FileUrlPathConverter &self, const std::vector<Str> &fileUrls,
+             const utils::PathType pathType) {
+            std::vector<Str> paths;
+            self.pathFromUrl(viewsOf(fileUrls), paths, pathType);
+            return paths;
+          },
+          py::arg("fileUrls"), py::arg("pathType") = utils::PathType::kSystem,
+          py::call_guard<py::gil_scoped_release>{})
+      .def("cacheStatistics", &utils::FileUrlPathConverter::cacheStatistics);
 
   mod.def("substitute", &utils::substitute, py::arg("input"), py::arg("substitutions"));
+
+  py::class_<utils::CompiledSubstitution>(mod, "CompiledSubstitution")
+      .def(py::init<std::string_view>(), py::arg("input"))
+      .def("input", &utils::CompiledSubstitution::input)
+      .def("keys", &utils::CompiledSubstitution::keys)
+      .def("render",
+           py::overload_cast<const openassetio::InfoDictionary &>(
+               &utils::CompiledSubstitution::render, py::const_),
+           py::arg("substitutions"))
+      .def(
+          "render",
+          [](const utils::CompiledSubstitution &self,
+             const std::vector<openassetio::InfoDictionary> &substitutionsBatch) {
+            std::vector<Str> results;
+            self.render(substitutionsBatch, results);
+            return results;
+          },
+          py::arg("substitutionsBatch"));
 }
@@ -81,6 +81,7 @@ from ._openassetio import (
     constants,
     Context,
     EntityReference,
+    EntityReferenceBatch,
     majorVersion,
     minorVersion,
     patchVersion,
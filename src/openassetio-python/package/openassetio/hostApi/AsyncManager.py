@@ -0,0 +1,150 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+@namespace openassetio.hostApi.AsyncManager
+A single-class module, providing the AsyncManager class.
+"""
+import asyncio
+import functools
+import inspect
+from concurrent.futures import ThreadPoolExecutor
+
+
+__all__ = ["AsyncManager"]
+
+
+class AsyncManager:
+    """
+    An asyncio-compatible wrapper around a @fqref{hostApi.Manager}
+    "Manager", for hosts built on an asyncio event loop.
+
+    Every method of the wrapped Manager is available on the
+    AsyncManager as a coroutine function of the same name, taking the
+    same arguments. Awaiting it runs the Manager call on a worker
+    thread, so the event loop is not blocked whilst the manager does
+    its work.
+
+    Manager methods release the GIL whilst calling into the manager,
+    so calls awaited concurrently (e.g. via `asyncio.gather`) execute
+    in parallel, to the extent the manager implementation allows.
+
+    @code{.py}
+    async with AsyncManager(manager) as asyncManager:
+        traitsDatas = await asyncManager.resolve(
+            entityReferences, traitSet, ResolveAccess.kRead, context,
+            Manager.BatchElementErrorPolicyTag.kVariant)
+    @endcode
+
+    @note Callbacks given to callback-based method overloads are
+    called on a worker thread, not the event loop's thread.
+
+    @note Cancelling an awaiting task does not interrupt the
+    underlying Manager call, which runs to completion in the
+    background.
+
+    @unstable
+    """
+
+    ## Prefix for the names of worker threads, if not given an
+    ## executor.
+    kThreadNamePrefix = "openassetio-AsyncManager"
+
+    def __init__(self, manager, executor=None, maxWorkers=None):
+        """
+        Wrap a Manager.
+
+        @param manager @fqref{hostApi.Manager} "Manager" The manager to
+        wrap.
+
+        @param executor `Optional[concurrent.futures.Executor]` The
+        executor to run Manager calls on. If not supplied, a
+        `ThreadPoolExecutor` is created, and is shut down by
+        @ref shutdown.
+
+        @param maxWorkers `Optional[int]` Maximum number of worker
+        threads of the created `ThreadPoolExecutor`. Must not be
+        given along with an `executor`.
+
+        @exception TypeError If `manager` is None, or both `executor`
+        and `maxWorkers` are given.
+        """
+        if manager is None:
+            raise TypeError("AsyncManager: Manager cannot be None")
+        if executor is not None and maxWorkers is not None:
+            raise TypeError("AsyncManager: Cannot specify both executor and maxWorkers")
+
+        self._manager = manager
+        self._ownsExecutor = executor is None
+        if executor is None:
+            executor = ThreadPoolExecutor(
+                max_workers=maxWorkers, thread_name_prefix=self.kThreadNamePrefix
+            )
+        self._executor = executor
+
+    def manager(self):
+        """
+        @return @fqref{hostApi.Manager} "Manager" The wrapped manager.
+        """
+        return self._manager
+
+    def executor(self):
+        """
+        @return `concurrent.futures.Executor` The executor that Manager
+        calls are run on.
+        """
+        return self._executor
+
+    def shutdown(self, wait=True):
+        """
+        Shut down the executor, if it was created by this instance.
+
+        A supplied executor is left running, since it may be shared.
+
+        @param wait `bool` Whether to block until pending calls have
+        completed.
+        """
+        if self._ownsExecutor:
+            self._executor.shutdown(wait=wait)
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, *_):
+        # Avoid blocking the event loop waiting for worker threads.
+        self.shutdown(wait=False)
+
+    def __getattr__(self, name):
+        # Private attributes are never forwarded, which also avoids
+        # infinite recursion if accessed before __init__ completes.
+        if name.startswith("_"):
+            raise AttributeError(name)
+
+        attr = getattr(self._manager, name)
+        # Forward e.g. nested enums and tag types as-is.
+        if not inspect.isroutine(attr):
+            return attr
+
+        executor = self._executor
+
+        @functools.wraps(attr)
+        async def method(*args, **kwargs):
+            loop = asyncio.get_running_loop()
+            return await loop.run_in_executor(executor, functools.partial(attr, *args, **kwargs))
+
+        return method
+
+    def __repr__(self):
+        return f"AsyncManager({self._manager!r})"
@@ -25,6 +25,7 @@ see @ref openassetio.managerApi.
 
 from .. import _openassetio  # pylint: disable=no-name-in-module
 
+from .AsyncManager import AsyncManager
 from .HostInterface import HostInterface
 
 Manager = _openassetio.hostApi.Manager
@@ -19,9 +19,11 @@ A single-class module, providing the PythonPluginSystem class.
 """
 
 import os.path
+import importlib.machinery
 import importlib.metadata
 import importlib.util
 import hashlib
+import json
 import sys
 import traceback
 
@@ -39,12 +41,41 @@ class PythonPluginSystem(object):
     registered with its identifier. Once a plug-in has registered an
     identifier, any subsequent registrations with that id will be
     skipped.
+
+    Optionally, a discovery cache file can be supplied. Identifiers of
+    successfully loaded plugins are then recorded in the cache, keyed
+    on the modification time and size of the plugin's module file (or,
+    for packages, of every module file within the package, including
+    compiled and extension modules). Entry point plugins are keyed on
+    the name and version of the providing distribution, as well as on
+    the module file (or package) the entry point resolved to, since the
+    code of an editable install can change without its version
+    changing. Subsequent scans that find a valid cache entry register
+    the identifier without importing the module. The module is then
+    only imported when the plugin is first requested via @ref plugin.
     """
 
     __validModuleExtensions = (".py", ".pyc")
 
-    def __init__(self, logger):
+    ## Version of the discovery cache file format. Cache files with a
+    ## different version are ignored.
+    kCacheVersion = 1
+
+    def __init__(self, logger, cachePath=None):
+        """
+        @param logger @fqref{log.LoggerInterface} "LoggerInterface"
+        used to output information about plugin loading.
+
+        @param cachePath `Optional[str]` Path to a discovery cache file.
+        If not set, then no caching is performed and all discovered
+        modules are imported during scanning. The file is created if it
+        does not exist, and is updated whenever a scan discovers
+        plugins that were not previously cached.
+        """
         self.__logger = logger
+        self.__cachePath = cachePath
+        self.__cache = None
+        self.__cacheModified = False
         self.reset()
 
     def reset(self):
@@ -53,6 +84,7 @@ class PythonPluginSystem(object):
         """
         self.__map = {}
         self.__paths = {}
+        self.__deferred = {}
 
     def scan(
         self,
@@ -160,10 +192,15 @@ class PythonPluginSystem(object):
                         )
                         continue
 
+                if self.__registerCachedPath(itemPath, moduleHookName):
+                    continue
+
                 self.__logger.debug(f"PythonPluginSystem: Attempting to load {itemPath}")
 
                 self.__load(itemPath, moduleHookName)
 
+        self.__saveCache()
+
     def scan_entry_points(self, entryPointName, moduleHookName):
         """
         Searches packages for entry points that define a
@@ -186,8 +223,17 @@ class PythonPluginSystem(object):
             f"PythonPluginSystem: Searching packages for '{entryPointName}' entry points."
         )
 
+        if self.__registerCachedEntryPoints(entryPointName, moduleHookName):
+            return True
+
+        cachedEntries = []
+
         for entryPoint in importlib.metadata.entry_points(group=entryPointName):
             self.__logger.debug(f"PythonPluginSystem: Found entry point in {entryPoint.name}")
+
+            if self.__registerCachedEntryPoint(entryPoint, moduleHookName, cachedEntries):
+                continue
+
             try:
                 module = entryPoint.load()
             except Exception:  # pylint: disable=broad-except
@@ -195,21 +241,21 @@ class PythonPluginSystem(object):
                     f"PythonPluginSystem: Caught exception loading {entryPoint.name}:\n"
                     + traceback.format_exc()
                 )
+                # Ensure the group isn't wholly served from the cache
+                # next time, so the error continues to be reported.
+                cachedEntries.append(None)
                 continue
 
-            if moduleHook := getattr(module, moduleHookName, None):
+            if moduleHook := self.__moduleHook(module, moduleHookName):
                 self.register(moduleHook, module.__file__)
-            elif hasattr(module, "plugin"):
-                self.__logger.warning(
-                    "PythonPluginSystem: Use of top-level 'plugin' variable is deprecated, "
-                    f"use `{moduleHookName}` instead. {module.__file__}"
+                cachedEntries.append(
+                    self.__entryPointCacheEntry(entryPoint, module.__file__, moduleHook)
                 )
-                self.register(module.plugin, module.__file__)
             else:
-                self.__logger.error(
-                    f"PythonPluginSystem: No top-level '{moduleHookName}' variable "
-                    f"{module.__file__}"
-                )
+                cachedEntries.append(None)
+
+        self.__updateEntryPointCache(entryPointName, moduleHookName, cachedEntries)
+        self.__saveCache()
 
         return True
 
@@ -231,13 +277,18 @@ class PythonPluginSystem(object):
         "PythonPluginSystemPlugin"
 
         @exception errors.InputValidationException Raised if no plugin
-        provides the specified identifier.
+        provides the specified identifier, or if the plugin was
+        registered from a stale discovery cache entry and could not be
+        loaded.
         """
 
         if identifier not in self.__map:
             msg = "PythonPluginSystem: No plug-in registered with the identifier '%s'" % identifier
             raise InputValidationException(msg)
 
+        if identifier in self.__deferred:
+            self.__loadDeferred(identifier)
+
         return self.__map[identifier]
 
     def register(self, cls, path="<unknown>"):
@@ -280,6 +331,28 @@ class PythonPluginSystem(object):
         @param moduleHookName `str` The name of the top-level variable
         that contains the plugin class.
         """
+        module = self.__importModule(path)
+        if module is None:
+            return
+
+        if moduleHook := self.__moduleHook(module, moduleHookName):
+            # Store where this plugin was loaded from. Not entirely
+            # accurate, but more useful for debugging than it not being
+            # there.
+            moduleHook.__file__ = path
+            self.register(moduleHook, module.__file__)
+            self.__updatePathCache(path, moduleHookName, moduleHook)
+
+    def __importModule(self, path):
+        """
+        Imports the specified python file under a unique module name.
+
+        @param path `str` This can be either a single-file module,
+        or the __init__.py at the root of a package.
+
+        @return The imported module, or `None` if an error occurred,
+        in which case it is logged.
+        """
 
         # Make a unique namespace to ensure the plugin identifier is
         # all that really matters
@@ -302,25 +375,377 @@ class PythonPluginSystem(object):
             self.__logger.error(
                 f"PythonPluginSystem: Caught exception loading {path}:\n" + traceback.format_exc()
             )
-            return
+            return None
+
+        return module
 
+    def __moduleHook(self, module, moduleHookName):
+        """
+        Retrieves the plugin class exposed by a loaded module, logging
+        if it is missing or uses the deprecated variable name.
+
+        @return The plugin class, or `None` if the module does not
+        expose one.
+        """
         if moduleHook := getattr(module, moduleHookName, None):
-            # Store where this plugin was loaded from. Not entirely
-            # accurate, but more useful for debugging than it not being
-            # there.
-            moduleHook.__file__ = path
-            self.register(moduleHook, module.__file__)
-        elif hasattr(module, "plugin"):
+            return moduleHook
+
+        if hasattr(module, "plugin"):
             self.__logger.warning(
                 "PythonPluginSystem: Use of top-level 'plugin' variable is deprecated, "
                 f"use `{moduleHookName}` instead. {module.__file__}"
             )
-            # Store where this plugin was loaded from. Not entirely
-            # accurate, but more useful for debugging than it not being
-            # there.
-            module.plugin.__file__ = path
-            self.register(module.plugin, module.__file__)
-        else:
-            self.__logger.error(
-                f"PythonPluginSystem: No top-level '{moduleHookName}' variable {module.__file__}"
+            return module.plugin
+
+        self.__logger.error(
+            f"PythonPluginSystem: No top-level '{moduleHookName}' variable {module.__file__}"
+        )
+        return None
+
+    def __deferRegistration(self, identifier, path, loader):
+        """
+        Registers an identifier found in the discovery cache, such that
+        the providing module is only imported when the plugin is first
+        requested.
+
+        @param loader `Callable[[], Optional[type]]` Function that
+        imports the module and returns its plugin class.
+        """
+        if identifier in self.__map:
+            self.__logger.warning(
+                f"PythonPluginSystem: Skipping cached plug-in '{identifier}' defined in"
+                f" '{path}'. Already registered by '{self.__paths[identifier]}'"
+            )
+            return
+
+        self.__logger.debug(
+            f"PythonPluginSystem: Registered cached plug-in '{identifier}' from '{path}'"
+        )
+
+        self.__map[identifier] = None
+        self.__paths[identifier] = path
+        self.__deferred[identifier] = loader
+
+    def __loadDeferred(self, identifier):
+        """
+        Imports the module providing a plugin that was registered from
+        the discovery cache.
+
+        @exception errors.InputValidationException Raised if the module
+        could not be loaded or no longer provides the identifier, i.e.
+        the cache entry was stale.
+        """
+        loader = self.__deferred.pop(identifier)
+        path = self.__paths[identifier]
+
+        self.__logger.debug(f"PythonPluginSystem: Loading cached plug-in {identifier} from {path}")
+
+        moduleHook = loader()
+
+        if moduleHook is None or moduleHook.identifier() != identifier:
+            del self.__map[identifier]
+            del self.__paths[identifier]
+            msg = (
+                f"PythonPluginSystem: Cached plug-in '{identifier}' could not be loaded from"
+                f" '{path}'. The discovery cache may be stale."
+            )
+            raise InputValidationException(msg)
+
+        self.__logger.debug(f"PythonPluginSystem: Registered plug-in '{moduleHook}' from '{path}'")
+        self.__map[identifier] = moduleHook
+
+    def __registerCachedPath(self, path, moduleHookName):
+        """
+        Registers the plugin provided by a module file, if a valid entry
+        exists in the discovery cache.
+
+        @return `bool` True if the plugin was registered from the cache.
+        """
+        cache = self.__loadCache()
+        if cache is None:
+            return False
+
+        entry = cache["paths"].get(path)
+        if entry is None or entry["hook"] != moduleHookName:
+            return False
+
+        if entry["stat"] != self.__statKey(path):
+            return False
+
+        def loader():
+            module = self.__importModule(path)
+            if module is None:
+                return None
+            moduleHook = self.__moduleHook(module, moduleHookName)
+            if moduleHook is not None:
+                moduleHook.__file__ = path
+            return moduleHook
+
+        self.__deferRegistration(entry["identifier"], path, loader)
+        return True
+
+    def __registerCachedEntryPoints(self, entryPointName, moduleHookName):
+        """
+        Registers all plugins of an entry point group from the discovery
+        cache, avoiding a query of installed distributions, if no
+        `sys.path` directory has been modified since they were cached.
+
+        @return `bool` True if the plugins were registered from the
+        cache.
+        """
+        cache = self.__loadCache()
+        if cache is None:
+            return False
+
+        group = cache["entryPoints"].get(self.__entryPointCacheKey(entryPointName, moduleHookName))
+        if group is None or group["sysPath"] != self.__sysPathKey():
+            return False
+
+        # Modifying an editable install's code does not modify any
+        # `sys.path` directory.
+        if not all(self.__isEntryPointModuleUnchanged(entry) for entry in group["entries"]):
+            return False
+
+        for entry in group["entries"]:
+            self.__deferEntryPoint(entry, entryPointName, moduleHookName)
+
+        return True
+
+    def __registerCachedEntryPoint(self, entryPoint, moduleHookName, cachedEntries):
+        """
+        Registers the plugin provided by an entry point, if a valid
+        entry exists in the discovery cache for the providing
+        distribution, and the entry point's module is unchanged.
+
+        @return `bool` True if the plugin was registered from the cache.
+        """
+        cache = self.__loadCache()
+        if cache is None:
+            return False
+
+        distKey = self.__distributionKey(entryPoint)
+        if distKey is None:
+            return False
+
+        group = cache["entryPoints"].get(
+            self.__entryPointCacheKey(entryPoint.group, moduleHookName), {}
+        )
+        for entry in group.get("entries", ()):
+            if (
+                entry["name"] == entryPoint.name
+                and entry["value"] == entryPoint.value
+                and entry["distribution"] == distKey
+                and self.__isEntryPointModuleUnchanged(entry)
+            ):
+                self.__deferEntryPoint(entry, entryPoint.group, moduleHookName)
+                cachedEntries.append(entry)
+                return True
+
+        return False
+
+    def __deferEntryPoint(self, entry, entryPointName, moduleHookName):
+        """
+        Defers registration of a cached entry point plugin until it is
+        first requested.
+        """
+
+        def loader():
+            entryPoint = importlib.metadata.EntryPoint(
+                name=entry["name"], value=entry["value"], group=entryPointName
+            )
+            try:
+                module = entryPoint.load()
+            except Exception:  # pylint: disable=broad-except
+                self.__logger.error(
+                    f"PythonPluginSystem: Caught exception loading {entryPoint.name}:\n"
+                    + traceback.format_exc()
+                )
+                return None
+            return self.__moduleHook(module, moduleHookName)
+
+        self.__deferRegistration(entry["identifier"], entry["path"], loader)
+
+    def __entryPointCacheEntry(self, entryPoint, path, moduleHook):
+        """
+        Constructs the discovery cache entry for a loaded entry point
+        plugin, or `None` if the providing distribution or module file
+        is unknown.
+        """
+        distKey = self.__distributionKey(entryPoint)
+        if distKey is None or path is None:
+            return None
+
+        return {
+            "name": entryPoint.name,
+            "value": entryPoint.value,
+            "distribution": distKey,
+            "path": path,
+            "stat": self.__statKey(path),
+            "identifier": moduleHook.identifier(),
+        }
+
+    def __isEntryPointModuleUnchanged(self, entry):
+        """
+        @return `bool` True if the module file (or package) that
+        provided a cached entry point plugin is unchanged since it was
+        cached.
+        """
+        try:
+            return entry.get("stat") == self.__statKey(entry["path"])
+        except OSError:
+            return False
+
+    def __updatePathCache(self, path, moduleHookName, moduleHook):
+        """
+        Records the identifier of a plugin loaded from a module file.
+        """
+        cache = self.__loadCache()
+        if cache is None:
+            return
+
+        cache["paths"][path] = {
+            "hook": moduleHookName,
+            "stat": self.__statKey(path),
+            "identifier": moduleHook.identifier(),
+        }
+        self.__cacheModified = True
+
+    def __updateEntryPointCache(self, entryPointName, moduleHookName, cachedEntries):
+        """
+        Records the identifiers of all plugins found for an entry point
+        group. The group as a whole is only cached if every entry point
+        loaded successfully and could be cached, otherwise individual
+        entries are retained for lookup by distribution.
+        """
+        cache = self.__loadCache()
+        if cache is None:
+            return
+
+        key = self.__entryPointCacheKey(entryPointName, moduleHookName)
+
+        validEntries = [entry for entry in cachedEntries if entry is not None]
+        # A `sysPath` of `None` never matches, forcing a full query of
+        # installed distributions on the next scan.
+        sysPathKey = self.__sysPathKey() if len(validEntries) == len(cachedEntries) else None
+        cache["entryPoints"][key] = {"sysPath": sysPathKey, "entries": validEntries}
+        self.__cacheModified = True
+
+    def __loadCache(self):
+        """
+        Reads the discovery cache file, if configured.
+
+        @return `Optional[dict]` The cache, or `None` if caching is
+        disabled.
+        """
+        if self.__cachePath is None:
+            return None
+
+        if self.__cache is not None:
+            return self.__cache
+
+        self.__cache = {"version": self.kCacheVersion, "paths": {}, "entryPoints": {}}
+
+        if not os.path.exists(self.__cachePath):
+            return self.__cache
+
+        try:
+            with open(self.__cachePath, "r", encoding="utf-8") as cacheFile:
+                cache = json.load(cacheFile)
+        except (OSError, ValueError) as exc:
+            self.__logger.warning(
+                f"PythonPluginSystem: Ignoring unreadable plugin cache {self.__cachePath}: {exc}"
+            )
+            return self.__cache
+
+        if not isinstance(cache, dict) or cache.get("version") != self.kCacheVersion:
+            self.__logger.debug(
+                f"PythonPluginSystem: Ignoring incompatible plugin cache {self.__cachePath}"
             )
+            return self.__cache
+
+        self.__cache = cache
+        return self.__cache
+
+    def __saveCache(self):
+        """
+        Writes the discovery cache file, if it has been modified.
+        """
+        if not self.__cacheModified:
+            return
+
+        tmpPath = f"{self.__cachePath}.{os.getpid()}.tmp"
+        try:
+            with open(tmpPath, "w", encoding="utf-8") as cacheFile:
+                json.dump(self.__cache, cacheFile)
+            # Atomic, such that concurrent processes never observe a
+            # partially written file.
+            os.replace(tmpPath, self.__cachePath)
+        except OSError as exc:
+            self.__logger.warning(
+                f"PythonPluginSystem: Unable to write plugin cache {self.__cachePath}: {exc}"
+            )
+            return
+
+        self.__cacheModified = False
+
+    @staticmethod
+    def __statKey(path):
+        """
+        @return `list` The modification time and size of a module file,
+        used to detect changes to a cached module. For the
+        `__init__.py` of a package, the modification time and size of
+        every module file within the package (including subpackages),
+        whether source, compiled or extension module, along with their
+        relative paths, such that changes to any of the package's
+        modules, or adding or removing modules, are detected.
+        """
+        if os.path.basename(path) != "__init__.py":
+            stat = os.stat(path)
+            return [stat.st_mtime_ns, stat.st_size]
+
+        packageDir = os.path.dirname(path)
+        key = []
+        moduleSuffixes = tuple(importlib.machinery.all_suffixes())
+        for dirPath, dirNames, fileNames in os.walk(packageDir):
+            # Bytecode caches are written as a side effect of importing,
+            # and are invalidated by changes to their source anyway.
+            # Sort in place, so the walk, and so the key, is ordered.
+            dirNames[:] = sorted(name for name in dirNames if name != "__pycache__")
+            for fileName in sorted(fileNames):
+                if not fileName.endswith(moduleSuffixes):
+                    continue
+                filePath = os.path.join(dirPath, fileName)
+                stat = os.stat(filePath)
+                key.append([os.path.relpath(filePath, packageDir), stat.st_mtime_ns, stat.st_size])
+        return key
+
+    @staticmethod
+    def __sysPathKey():
+        """
+        @return `List[list]` The current `sys.path` entries along with
+        their modification times. Installing or removing a distribution
+        modifies the directory it is installed into.
+        """
+        key = []
+        for path in sys.path:
+            try:
+                mtime = os.stat(path or os.curdir).st_mtime_ns
+            except OSError:
+                mtime = None
+            key.append([path, mtime])
+        return key
+
+    @staticmethod
+    def __distributionKey(entryPoint):
+        """
+        @return `Optional[List[str]]` The name and version of the
+        distribution providing an entry point, or `None` if unknown.
+        """
+        dist = entryPoint.dist
+        if dist is None:
+            return None
+        return [dist.name, dist.version]
+
+    @staticmethod
+    def __entryPointCacheKey(entryPointName, moduleHookName):
+        return f"{entryPointName}:{moduleHookName}"
@@ -19,6 +19,8 @@ A single-class module, providing the
 PythonPluginSystemManagerImplementationFactory class.
 """
 
+import os
+
 from ..hostApi import ManagerImplementationFactoryInterface
 
 from .PythonPluginSystem import PythonPluginSystem
@@ -59,12 +61,22 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
     it is not in use, to avoid unnecessary filesystem access during
     library initialization. **OPENASSETIO_PLUGIN_PATH** plugins take
     precedence over any entry point based ones.
+
+    @envvar **OPENASSETIO_PYTHON_PLUGIN_CACHE** *str* Path to a file
+    used to cache the identifiers of discovered plugins between
+    sessions. When set, plugin modules whose file has not changed since
+    they were cached (or, for entry point plugins, whose distribution
+    version has not changed) are not imported until they are first
+    instantiated. This can considerably reduce startup time when many
+    plugins are installed.
     """
 
     ## The Environment Variable to read the plug-in search path from
     kPluginEnvVar = "OPENASSETIO_PLUGIN_PATH"
     ## The Environment Variable to control the discovery of entry point based plugins
     kDisableEntryPointsEnvVar = "OPENASSETIO_DISABLE_ENTRYPOINTS_PLUGINS"
+    ## The Environment Variable to read the discovery cache file path from
+    kPluginCacheEnvVar = "OPENASSETIO_PYTHON_PLUGIN_CACHE"
 
     ## The name of the ManagerPlugin entry point for entry point
     ## discovered plugins.
@@ -74,7 +86,7 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
     ## class.
     kModuleHookName = "openassetioPlugin"
 
-    def __init__(self, logger, paths=None, disableEntryPointsPlugins=None):
+    def __init__(self, logger, paths=None, disableEntryPointsPlugins=None, cachePath=None):
         """
         Creates a new factory. The factory scans for plugins lazily on
         the first invocation of @ref identifiers or @ref instantiate.
@@ -90,6 +102,10 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         package entry point based plugin discovery is allowed. Defaults
         to False unless the @ref kDisableEntryPointsEnvVar environment
         variable is set.
+
+        @param cachePath `str` Path to a plugin discovery cache file.
+        Defaults to the value of the @ref kPluginCacheEnvVar environment
+        variable. If neither is set, then no cache is used.
         """
 
         super(PythonPluginSystemManagerImplementationFactory, self).__init__(logger)
@@ -97,6 +113,7 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         self.__pluginManager = None
         self.__paths = paths
         self.__disableEntryPointsPlugins = disableEntryPointsPlugins
+        self.__cachePath = cachePath
 
     def __scan(self):
         """
@@ -104,7 +121,8 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         with the factory instance.
         """
         # Construct this here, so we have this even if we early out
-        self.__pluginManager = PythonPluginSystem(self._logger)
+        cachePath = self.__cachePath or os.environ.get(self.kPluginCacheEnvVar) or None
+        self.__pluginManager = PythonPluginSystem(self._logger, cachePath)
         self.__pluginManager.scan(
             self.__paths,
             self.kPluginEnvVar,
@@ -26,3 +26,5 @@ PathType = _openassetio.utils.PathType
 FileUrlPathConverter = _openassetio.utils.FileUrlPathConverter
 
 substitute = _openassetio.utils.substitute
+
+CompiledSubstitution = _openassetio.utils.CompiledSubstitution
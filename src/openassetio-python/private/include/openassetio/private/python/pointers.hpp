@@ -46,9 +46,14 @@ Ptr createPyRetainingPtr(const py::object& pyInstance,
   // Custom deleter for shared_ptr below.
   const auto deleter = [](py::object* pyObjectPtr) {
     // Note: Technically we have a race condition here with
-    // _Py_IsFinalizing if multiple threads are involved, but that is a
+    // Py_IsFinalizing if multiple threads are involved, but that is a
     // corner case of a corner case, and difficult to solve.
+#if PY_VERSION_HEX >= 0x030D0000
+    // Private _Py_IsFinalizing was removed in Python 3.13.
+    if (Py_IsFinalizing()) {
+#else
     if (_Py_IsFinalizing()) {
+#endif
       // If the Python interpreter is gone, clear the internal PyObject*
       // so pybind11 won't attempt to clean it up.
       pyObjectPtr->release();
@@ -0,0 +1,188 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Benchmarks of delivering batch results from a Python manager to a host,
+comparing a callback invocation per element with a single
+`successCallback.many(...)` invocation per batch.
+
+A synthetic Python manager resolves every reference successfully,
+returning the same pre-built TraitsData for each element. The host
+calls `resolve` through the C++ `Manager`, either with the
+exception-throwing convenience overload (C++ callbacks), or with
+Python callbacks.
+"""
+# pylint: disable=invalid-name,missing-function-docstring
+
+import os
+import statistics
+import sys
+import time
+
+from openassetio import Context, EntityReference
+from openassetio.access import ResolveAccess
+from openassetio.hostApi import HostInterface, Manager
+from openassetio.log import ConsoleLogger, SeverityFilter
+from openassetio.managerApi import Host, HostSession, ManagerInterface
+from openassetio.trait import TraitsData
+
+
+## Number of times to run each benchmark.
+kRepeat = 10
+
+## Default batch sizes, overridable by a comma-separated environment
+## variable.
+kDefaultBatchSizes = "10000,100000"
+
+
+class BenchmarkHostInterface(HostInterface):
+    # pylint: disable=missing-class-docstring
+    def identifier(self):
+        return "org.openassetio.benchmark.host"
+
+    def displayName(self):
+        return "Benchmark Host"
+
+
+class PerElementManagerInterface(ManagerInterface):
+    """
+    Manager that calls the success callback once per element.
+    """
+
+    def __init__(self):
+        super().__init__()
+        self._traitsData = TraitsData({"aTrait"})
+
+    def identifier(self):
+        return "org.openassetio.benchmark.batchCallback.perElement"
+
+    def displayName(self):
+        return "Per-element"
+
+    def hasCapability(self, capability):
+        return capability == ManagerInterface.Capability.kResolution
+
+    def resolve(
+        self,
+        entityRefs,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        traitsData = self._traitsData
+        for idx in range(len(entityRefs)):
+            successCallback(idx, traitsData)
+
+
+class ManyManagerInterface(PerElementManagerInterface):
+    """
+    Manager that calls the success callback once for the whole batch.
+    """
+
+    def identifier(self):
+        return "org.openassetio.benchmark.batchCallback.many"
+
+    def displayName(self):
+        return "Many"
+
+    def resolve(
+        self,
+        entityRefs,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        count = len(entityRefs)
+        successCallback.many(range(count), [self._traitsData] * count)
+
+
+def benchmark(name, fn):
+    """
+    Run a function @ref kRepeat times, printing timing statistics.
+
+    @param fn `Callable[[], Any]` The function to time.
+    """
+    timings = []
+    results = []
+    for _ in range(kRepeat):
+        start = time.perf_counter()
+        # Keep results alive, so destruction is not timed.
+        results.append(fn())
+        timings.append(time.perf_counter() - start)
+
+    print(
+        f"{name:<70} min {min(timings) * 1e3:9.3f} ms"
+        f"  median {statistics.median(timings) * 1e3:9.3f} ms"
+        f"  max {max(timings) * 1e3:9.3f} ms"
+    )
+
+
+def benchmarkManager(managerInterface, hostSession, entityRefs):
+    """
+    Run the suite of resolve benchmarks for a given manager interface.
+    """
+    manager = Manager(managerInterface, hostSession)
+    context = Context()
+    traitSet = {"aTrait"}
+    suffix = f" [{managerInterface.displayName()}, {len(entityRefs)} elements]"
+
+    benchmark(
+        "resolve, C++ callbacks" + suffix,
+        lambda: manager.resolve(
+            entityRefs,
+            traitSet,
+            ResolveAccess.kRead,
+            context,
+            Manager.BatchElementErrorPolicyTag.kException,
+        ),
+    )
+
+    def resolveWithPythonCallbacks():
+        results = [None] * len(entityRefs)
+
+        def onSuccess(idx, traitsData):
+            results[idx] = traitsData
+
+        def onError(idx, error):
+            raise RuntimeError(f"Unexpected error for element {idx}: {error}")
+
+        manager.resolve(entityRefs, traitSet, ResolveAccess.kRead, context, onSuccess, onError)
+        return results
+
+    benchmark("resolve, Python callbacks" + suffix, resolveWithPythonCallbacks)
+
+
+def main():
+    sizes = os.environ.get("OPENASSETIO_BENCHMARK_BATCH_SIZES", kDefaultBatchSizes)
+    batchSizes = [int(size) for size in sizes.split(",")]
+    logger = SeverityFilter(ConsoleLogger())
+    hostSession = HostSession(Host(BenchmarkHostInterface()), logger)
+
+    for batchSize in batchSizes:
+        entityRefs = [EntityReference(f"bench://{idx}") for idx in range(batchSize)]
+        for managerInterface in (PerElementManagerInterface(), ManyManagerInterface()):
+            benchmarkManager(managerInterface, hostSession, entityRefs)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,283 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Benchmarks of manager plugin discovery, instantiation and
+initialization latency from a Python host.
+
+Synthetic Python manager plugins are generated into several search path
+directories in a temporary directory. Synthetic C++ manager plugins are
+taken from the directory given by the
+`OPENASSETIO_BENCHMARK_CPP_PLUGINS_ROOT` environment variable, if set,
+in which case the hybrid (C++ and Python) plugin system is also
+benchmarked.
+
+"New factory" benchmarks construct a factory for each run, so include
+scanning all plugins. Note that these are not fully cold: C++ plugin
+libraries are never unloaded once loaded, and plugin files are in the
+OS file cache after the first run. "First" benchmarks time the first
+use of a factory that has already scanned. "Warm" benchmarks re-use a
+factory that has already been used.
+"""
+# pylint: disable=invalid-name,missing-function-docstring
+
+import os
+import statistics
+import sys
+import tempfile
+import time
+
+from openassetio.hostApi import HostInterface, ManagerFactory
+from openassetio.log import ConsoleLogger, SeverityFilter
+from openassetio.pluginSystem import (
+    CppPluginSystemManagerImplementationFactory,
+    HybridPluginSystemManagerImplementationFactory,
+    PythonPluginSystemManagerImplementationFactory,
+)
+
+
+## Number of times to run each benchmark.
+kRepeat = 20
+
+kPluginTemplate = """
+from openassetio import constants
+from openassetio.managerApi import ManagerInterface
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+
+
+class BenchmarkManagerInterface(ManagerInterface):
+    def identifier(self):
+        return "org.openassetio.benchmark.pluginSystem.py{idx}"
+
+    def displayName(self):
+        return "py{idx}"
+
+    def info(self):
+        return {{constants.kInfoKey_EntityReferencesMatchPrefix: "py{idx}://"}}
+
+    def hasCapability(self, capability):
+        return capability in (
+            ManagerInterface.Capability.kEntityReferenceIdentification,
+            ManagerInterface.Capability.kManagementPolicyQueries,
+            ManagerInterface.Capability.kEntityTraitIntrospection,
+        )
+
+    def initialize(self, managerSettings, hostSession):
+        pass
+
+
+class BenchmarkPlugin(PythonPluginSystemManagerPlugin):
+    @classmethod
+    def identifier(cls):
+        return "org.openassetio.benchmark.pluginSystem.py{idx}"
+
+    @classmethod
+    def interface(cls):
+        return BenchmarkManagerInterface()
+
+
+openassetioPlugin = BenchmarkPlugin
+"""
+
+
+class BenchmarkHostInterface(HostInterface):
+    # pylint: disable=missing-class-docstring
+    def identifier(self):
+        return "org.openassetio.benchmark.host"
+
+    def displayName(self):
+        return "Benchmark Host"
+
+
+def generatePythonPlugins(root, pluginCount, pathCount):
+    """
+    Write synthetic Python manager plugin modules, distributed
+    round-robin across search path directories.
+
+    @return `List[str]` The search path directories.
+    """
+    paths = [os.path.join(root, f"path{pathIdx}") for pathIdx in range(pathCount)]
+    for path in paths:
+        os.makedirs(path)
+
+    for pluginIdx in range(pluginCount):
+        modulePath = os.path.join(paths[pluginIdx % pathCount], f"benchmarkPlugin{pluginIdx}.py")
+        with open(modulePath, "w", encoding="utf-8") as moduleFile:
+            moduleFile.write(kPluginTemplate.format(idx=pluginIdx))
+
+    return paths
+
+
+def cppPluginPaths():
+    """
+    @return `List[str]` The synthetic C++ plugin search path
+    directories, or an empty list if unavailable.
+    """
+    root = os.environ.get("OPENASSETIO_BENCHMARK_CPP_PLUGINS_ROOT")
+    if not root or not os.path.isdir(root):
+        return []
+    return sorted(
+        os.path.join(root, entry)
+        for entry in os.listdir(root)
+        if os.path.isdir(os.path.join(root, entry))
+    )
+
+
+def benchmark(name, setup, fn):
+    """
+    Run a function @ref kRepeat times, printing timing statistics.
+
+    @param setup `Callable[[], Any]` Called before each run, outside
+    of the timed region. Its return value is passed to @p fn.
+
+    @param fn `Callable[[Any], Any]` The function to time.
+    """
+    timings = []
+    results = []
+    for _ in range(kRepeat):
+        state = setup()
+        start = time.perf_counter()
+        # Keep results alive, so destruction is not timed.
+        results.append(fn(state))
+        timings.append(time.perf_counter() - start)
+        results.append(state)
+
+    print(
+        f"{name:<70} min {min(timings) * 1e3:9.3f} ms"
+        f"  median {statistics.median(timings) * 1e3:9.3f} ms"
+        f"  max {max(timings) * 1e3:9.3f} ms"
+    )
+
+
+def benchmarkFactory(label, makeImplFactory, logger):
+    """
+    Run the suite of discovery benchmarks for a given manager
+    implementation factory.
+    """
+    hostInterface = BenchmarkHostInterface()
+
+    def makeFactory():
+        return ManagerFactory(hostInterface, makeImplFactory(), logger)
+
+    def makeScannedFactory():
+        factory = makeFactory()
+        return factory, factory.identifiers()
+
+    identifiers = makeFactory().identifiers()
+    suffix = f" [{label}, {len(identifiers)} plugins]"
+    # Last plugin found, i.e. worst case.
+    identifier = identifiers[-1]
+
+    benchmark(
+        "new ManagerFactory + identifiers" + suffix,
+        lambda: None,
+        lambda _: makeFactory().identifiers(),
+    )
+
+    warmFactory, _ = makeScannedFactory()
+    benchmark("warm identifiers" + suffix, lambda: warmFactory, lambda f: f.identifiers())
+
+    benchmark(
+        "first createManager after identifiers" + suffix,
+        lambda: makeScannedFactory()[0],
+        lambda f: f.createManager(identifier),
+    )
+
+    warmFactory.createManager(identifier)
+    benchmark(
+        "warm createManager" + suffix,
+        lambda: warmFactory,
+        lambda f: f.createManager(identifier),
+    )
+
+    benchmark(
+        "first initialize" + suffix,
+        lambda: warmFactory.createManager(identifier),
+        lambda manager: manager.initialize({}),
+    )
+
+
+def main():
+    pluginCount = int(os.environ.get("OPENASSETIO_BENCHMARK_PLUGIN_COUNT", "32"))
+    pathCount = int(os.environ.get("OPENASSETIO_BENCHMARK_PLUGIN_PATH_COUNT", "4"))
+
+    logger = SeverityFilter(ConsoleLogger())
+
+    with tempfile.TemporaryDirectory() as root:
+        pythonPaths = generatePythonPlugins(root, pluginCount, pathCount)
+        cppPaths = cppPluginPaths()
+        cachePath = os.path.join(root, "pluginCache.json")
+
+        # Double the number of search paths each iteration, always
+        # including the full set.
+        pathCounts = []
+        count = 1
+        while count < pathCount:
+            pathCounts.append(count)
+            count *= 2
+        pathCounts.append(pathCount)
+
+        for count in pathCounts:
+            pythonSearchPath = os.pathsep.join(pythonPaths[:count])
+            label = f"{count} paths"
+
+            benchmarkFactory(
+                f"Python, {label}",
+                lambda p=pythonSearchPath: PythonPluginSystemManagerImplementationFactory(
+                    logger, paths=p, disableEntryPointsPlugins=True
+                ),
+                logger,
+            )
+
+            benchmarkFactory(
+                f"Python with discovery cache, {label}",
+                lambda p=pythonSearchPath: PythonPluginSystemManagerImplementationFactory(
+                    logger, paths=p, disableEntryPointsPlugins=True, cachePath=cachePath
+                ),
+                logger,
+            )
+
+            if not cppPaths:
+                continue
+
+            cppSearchPath = os.pathsep.join(cppPaths[:count])
+
+            benchmarkFactory(
+                f"C++, {label}",
+                lambda p=cppSearchPath: CppPluginSystemManagerImplementationFactory(p, logger),
+                logger,
+            )
+
+            benchmarkFactory(
+                f"Hybrid, {label}",
+                lambda cp=cppSearchPath, pp=pythonSearchPath: (
+                    HybridPluginSystemManagerImplementationFactory(
+                        [
+                            CppPluginSystemManagerImplementationFactory(cp, logger),
+                            PythonPluginSystemManagerImplementationFactory(
+                                logger, paths=pp, disableEntryPointsPlugins=True
+                            ),
+                        ],
+                        logger,
+                    )
+                ),
+                logger,
+            )
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
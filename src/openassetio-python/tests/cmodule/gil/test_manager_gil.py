@@ -281,6 +281,11 @@ class Test_Manager_gil:
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kException)
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kVariant)
 
+    def test_resolveProperties(self, a_threaded_manager, a_context):
+        a_threaded_manager.resolveProperties(
+            [], [("a_trait", "a_property")], access.ResolveAccess.kRead, a_context
+        )
+
     def test_settings(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.settings.return_value = {}
         a_threaded_manager.settings()
@@ -0,0 +1,290 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Stress tests calling the Python bindings from many threads at once.
+
+With the GIL, these check that the bindings that release the GIL
+tolerate concurrent use. In free-threaded (no-GIL) Python builds they
+also check the per-object locking of bindings with mutable state,
+which is otherwise provided by the GIL.
+"""
+# pylint: disable=redefined-outer-name
+# pylint: disable=invalid-name,c-extension-no-member
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import sys
+import sysconfig
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+# pylint: disable=no-name-in-module
+from openassetio import access, errors, Context, EntityReference, EntityReferenceBatch
+from openassetio.hostApi import Manager
+from openassetio.managerApi import ManagerInterface
+from openassetio.trait import TraitsData
+from openassetio.utils import FileUrlPathConverter, PathType
+
+
+kNumThreads = 8
+kNumIterations = 200
+
+kTraitId = "stress"
+kPropertyKey = "value"
+
+
+def run_concurrently(fn, num_threads=kNumThreads):
+    """
+    Call `fn(threadIdx)` from `num_threads` threads, released at the
+    same time, returning the results in thread order.
+
+    Exceptions raised in any thread are re-raised.
+    """
+    barrier = threading.Barrier(num_threads)
+
+    def worker(threadIdx):
+        barrier.wait()
+        return fn(threadIdx)
+
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        return list(executor.map(worker, range(num_threads)))
+
+
+@pytest.mark.skipif(
+    not sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Requires free-threaded Python"
+)
+def test_when_imported_in_free_threaded_build_then_gil_is_not_enabled():
+    # Importing an extension module that doesn't declare free-threading
+    # support re-enables the GIL, with a warning.
+    assert not sys._is_gil_enabled()  # pylint: disable=protected-access
+
+
+class Test_TraitsData_threading:
+    def test_when_properties_set_concurrently_then_all_properties_are_set(self):
+        traits_data = TraitsData()
+
+        def set_properties(threadIdx):
+            trait_id = f"trait{threadIdx}"
+            for idx in range(kNumIterations):
+                traits_data.setTraitProperty(trait_id, f"prop{idx}", idx)
+
+        run_concurrently(set_properties)
+
+        assert traits_data.traitSet() == {f"trait{idx}" for idx in range(kNumThreads)}
+        for threadIdx in range(kNumThreads):
+            trait_id = f"trait{threadIdx}"
+            assert len(traits_data.traitPropertyKeys(trait_id)) == kNumIterations
+            for idx in range(kNumIterations):
+                assert traits_data.getTraitProperty(trait_id, f"prop{idx}") == idx
+
+    def test_when_read_whilst_modified_then_reads_are_consistent(self):
+        traits_data = TraitsData()
+        traits_data.setTraitProperty(kTraitId, kPropertyKey, 0)
+
+        def read_or_write(threadIdx):
+            for idx in range(kNumIterations):
+                if threadIdx % 2:
+                    traits_data.setTraitProperty(kTraitId, kPropertyKey, idx)
+                    traits_data.addTrait(f"trait{threadIdx}_{idx}")
+                else:
+                    traits_dict = traits_data.toDict()
+                    assert isinstance(traits_dict[kTraitId][kPropertyKey], int)
+                    assert TraitsData(traits_data).hasTrait(kTraitId)
+                    assert kTraitId in str(traits_data)
+                    assert traits_data.hasTrait(kTraitId)
+
+        run_concurrently(read_or_write)
+
+        assert len(traits_data.traitSet()) == 1 + (kNumThreads // 2) * kNumIterations
+
+    def test_when_compared_whilst_modified_then_no_deadlock(self):
+        traits_datas = [TraitsData({kTraitId}), TraitsData({kTraitId})]
+
+        def compare_and_write(threadIdx):
+            # Alternate operand order, which would deadlock naive
+            # per-object mutexes.
+            lhs, rhs = traits_datas[threadIdx % 2], traits_datas[(threadIdx + 1) % 2]
+            for idx in range(kNumIterations):
+                lhs.setTraitProperty(kTraitId, kPropertyKey, idx)
+                _ = lhs == rhs
+
+        run_concurrently(compare_and_write)
+
+
+class Test_Context_threading:
+    def test_when_locale_assigned_concurrently_then_reads_get_an_assigned_locale(self):
+        locales = [TraitsData({f"locale{idx}"}) for idx in range(kNumThreads)]
+        context = Context(locales[0])
+
+        def assign_and_read(threadIdx):
+            for _ in range(kNumIterations):
+                context.locale = locales[threadIdx]
+                assert any(context.locale is locale for locale in locales)
+
+        run_concurrently(assign_and_read)
+
+
+class Test_FileUrlPathConverter_threading:
+    def test_when_batches_converted_whilst_inputs_modified_then_results_are_consistent(self):
+        converter = FileUrlPathConverter()
+        paths = [f"/some/path/file {idx}.exr" for idx in range(kNumIterations)]
+        expected_urls = [f"file:///some/path/file%20{idx}.exr" for idx in range(kNumIterations)]
+
+        def convert_or_modify(threadIdx):
+            for idx in range(kNumIterations):
+                if threadIdx == 0:
+                    # Replace elements whilst other threads convert the
+                    # same list, with the GIL released.
+                    paths[idx] = f"/some/path/file {idx}.exr"
+                else:
+                    urls = converter.pathToUrl(paths, PathType.kPOSIX)
+                    assert urls == expected_urls
+                    assert converter.pathFromUrl(urls, PathType.kPOSIX) == paths
+
+        run_concurrently(convert_or_modify)
+
+
+class Test_Manager_threading:
+    def test_when_resolved_concurrently_then_results_are_correct(self, a_manager, a_context):
+        def resolve(threadIdx):
+            refs = [
+                EntityReference(f"stress://{threadIdx}/{idx}") for idx in range(kNumIterations)
+            ]
+            results = a_manager.resolve(
+                refs,
+                {kTraitId},
+                access.ResolveAccess.kRead,
+                a_context,
+                Manager.BatchElementErrorPolicyTag.kVariant,
+            )
+            for idx, result in enumerate(results):
+                assert result.getTraitProperty(kTraitId, kPropertyKey) == f"{threadIdx}/{idx}"
+
+        run_concurrently(resolve)
+
+    def test_when_errors_resolved_concurrently_then_results_are_correct(
+        self, a_manager, a_context
+    ):
+        def resolve(threadIdx):
+            refs = [
+                EntityReference(f"stress://{threadIdx}/{idx}" if idx % 2 else "stress://error")
+                for idx in range(kNumIterations)
+            ]
+            results = a_manager.resolve(
+                refs,
+                {kTraitId},
+                access.ResolveAccess.kRead,
+                a_context,
+                Manager.BatchElementErrorPolicyTag.kVariant,
+            )
+            for idx, result in enumerate(results):
+                if idx % 2:
+                    assert result.getTraitProperty(kTraitId, kPropertyKey) == f"{threadIdx}/{idx}"
+                else:
+                    assert isinstance(result, errors.BatchElementError)
+                    assert result.message == "stress://error"
+
+        run_concurrently(resolve)
+
+    def test_when_batch_resolved_concurrently_then_results_are_correct(self, a_manager, a_context):
+        # A single batch, shared between all threads.
+        batch = EntityReferenceBatch.fromStrings(
+            [f"stress://shared/{idx}" for idx in range(kNumIterations)]
+        )
+
+        def resolve_properties(_threadIdx):
+            return a_manager.resolveProperties(
+                batch, [(kTraitId, kPropertyKey)], access.ResolveAccess.kRead, a_context
+            )
+
+        expected = [[f"shared/{idx}" for idx in range(kNumIterations)]]
+
+        assert run_concurrently(resolve_properties) == [expected] * kNumThreads
+
+    def test_when_override_replaced_concurrently_then_calls_use_either_override(
+        self, a_host_session
+    ):
+        # Local subclass, so the replaced method doesn't leak into other
+        # tests.
+        class ReplaceableManagerInterface(StressManagerInterface):
+            def displayName(self):
+                return "original"
+
+        def replacement(_self):
+            return "replacement"
+
+        original = ReplaceableManagerInterface.displayName
+        manager = Manager(ReplaceableManagerInterface(), a_host_session)
+
+        def replace_or_call(threadIdx):
+            for idx in range(kNumIterations):
+                if threadIdx == 0:
+                    ReplaceableManagerInterface.displayName = replacement if idx % 2 else original
+                else:
+                    assert manager.displayName() in ("original", "replacement")
+
+        run_concurrently(replace_or_call)
+
+        ReplaceableManagerInterface.displayName = replacement
+        assert manager.displayName() == "replacement"
+
+
+class StressManagerInterface(ManagerInterface):
+    """
+    Minimal, stateless and so thread-safe, manager that resolves an
+    entity reference to a property containing the remainder of the
+    reference string.
+    """
+
+    kPrefix = "stress://"
+
+    def identifier(self):
+        return "org.openassetio.test.manager.stress"
+
+    def displayName(self):
+        return "Stress Test Manager"
+
+    def hasCapability(self, capability):
+        return capability == ManagerInterface.Capability.kResolution
+
+    def resolve(
+        self,
+        entityRefs,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, ref in enumerate(entityRefs):
+            ref_str = ref.toString()
+            if ref_str == "stress://error":
+                errorCallback(
+                    idx,
+                    errors.BatchElementError(
+                        errors.BatchElementError.ErrorCode.kEntityResolutionError, ref_str
+                    ),
+                )
+                continue
+            traits_data = TraitsData()
+            traits_data.setTraitProperty(kTraitId, kPropertyKey, ref_str[len(self.kPrefix) :])
+            successCallback(idx, traits_data)
+
+
+@pytest.fixture
+def a_manager(a_host_session):
+    return Manager(StressManagerInterface(), a_host_session)
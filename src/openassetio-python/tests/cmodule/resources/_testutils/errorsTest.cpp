@@ -18,6 +18,7 @@
 #include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
 
+#include <PyOverrideCache.hpp>
 #include <errors/exceptionsConverter.hpp>
 #include <overrideMacros.hpp>
 
@@ -307,6 +308,10 @@ struct ExceptionThrower {
   virtual void throwFromOverridePure() = 0;
   virtual void throwFromOverrideName() {}
   virtual void throwFromOverrideArgs() {}
+  virtual void throwFromCachedOverride() {}
+  virtual void throwFromCachedOverridePure() = 0;
+  virtual void throwFromCachedOverrideName() {}
+  virtual void throwFromCachedOverrideArgs() {}
 };
 
 /**
@@ -330,6 +335,26 @@ struct PyExceptionThrower final : ExceptionThrower {
   void throwFromOverrideArgs() override {
     OPENASSETIO_PYBIND11_OVERRIDE_ARGS(void, ExceptionThrower, throwFromOverrideArgs, (), );
   }
+  void throwFromCachedOverride() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(overrideCache_, void, ExceptionThrower,
+                                         throwFromCachedOverride, );
+  }
+  void throwFromCachedOverridePure() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(overrideCache_, void, ExceptionThrower,
+                                              throwFromCachedOverridePure, );
+  }
+  void throwFromCachedOverrideName() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(overrideCache_, void, ExceptionThrower,
+                                              "throwFromCachedOverrideName",
+                                              throwFromCachedOverrideName, );
+  }
+  void throwFromCachedOverrideArgs() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(overrideCache_, void, ExceptionThrower,
+                                              throwFromCachedOverrideArgs, (), );
+  }
+
+ private:
+  openassetio::PyOverrideCache overrideCache_;
 };
 
 /**
@@ -400,6 +425,14 @@ extern void registerExceptionThrower(py::module_& mod) {
                executeFnAndCatch([&] { exceptionThrower.throwFromOverrideName(); },
                                  catchExceptionName) &&
                executeFnAndCatch([&] { exceptionThrower.throwFromOverridePure(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverride(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverrideArgs(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverrideName(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverridePure(); },
                                  catchExceptionName);
       },
       py::arg("exceptionThrower"), py::arg("catchExceptionName"),
@@ -444,5 +477,9 @@ extern void registerExceptionThrower(py::module_& mod) {
       .def("throwFromOverride", &ExceptionThrower::throwFromOverride)
       .def("throwFromOverridePure", &ExceptionThrower::throwFromOverridePure)
       .def("throwFromOverrideName", &ExceptionThrower::throwFromOverrideName)
-      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs);
+      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs)
+      .def("throwFromCachedOverride", &ExceptionThrower::throwFromCachedOverride)
+      .def("throwFromCachedOverridePure", &ExceptionThrower::throwFromCachedOverridePure)
+      .def("throwFromCachedOverrideName", &ExceptionThrower::throwFromCachedOverrideName)
+      .def("throwFromCachedOverrideArgs", &ExceptionThrower::throwFromCachedOverrideArgs);
 }
@@ -181,6 +181,18 @@ class PyExceptionThrower(_openassetio._testutils.ExceptionThrower):
     def throwFromOverrideArgs(self):
         self.callee()
 
+    def throwFromCachedOverride(self):
+        self.callee()
+
+    def throwFromCachedOverridePure(self):
+        self.callee()
+
+    def throwFromCachedOverrideName(self):
+        self.callee()
+
+    def throwFromCachedOverrideArgs(self):
+        self.callee()
+
 
 @pytest.fixture
 def exception_thrower():
@@ -0,0 +1,200 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the AsyncManager asyncio wrapper.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+
+import asyncio
+import inspect
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+from openassetio import Context, errors
+from openassetio.access import ResolveAccess
+from openassetio.hostApi import AsyncManager, Manager
+from openassetio.trait import TraitsData
+
+
+class Test_AsyncManager_init:
+    def test_when_manager_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError, match="AsyncManager: Manager cannot be None"):
+            AsyncManager(None)
+
+    def test_when_executor_and_maxWorkers_given_then_raises_TypeError(self, manager):
+        with ThreadPoolExecutor() as executor:
+            with pytest.raises(
+                TypeError, match="AsyncManager: Cannot specify both executor and maxWorkers"
+            ):
+                AsyncManager(manager, executor=executor, maxWorkers=2)
+
+    def test_manager_is_wrapped_manager(self, manager):
+        async_manager = AsyncManager(manager)
+
+        assert async_manager.manager() is manager
+
+        async_manager.shutdown()
+
+    def test_when_executor_given_then_executor_is_used(self, manager):
+        with ThreadPoolExecutor() as executor:
+            assert AsyncManager(manager, executor=executor).executor() is executor
+
+
+class Test_AsyncManager_methods:
+    def test_manager_methods_are_coroutine_functions(self, async_manager):
+        assert inspect.iscoroutinefunction(async_manager.displayName)
+        assert inspect.iscoroutinefunction(async_manager.resolve)
+
+    def test_nested_types_are_forwarded_as_is(self, async_manager):
+        assert async_manager.Capability is Manager.Capability
+        assert async_manager.BatchElementErrorPolicyTag is Manager.BatchElementErrorPolicyTag
+
+    def test_when_attribute_is_unknown_then_raises_AttributeError(self, async_manager):
+        with pytest.raises(AttributeError):
+            _ = async_manager.notAManagerMethod
+
+    def test_when_awaited_then_returns_result_of_manager_method(
+        self, async_manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.displayName.return_value = "A Manager"
+
+        assert asyncio.run(async_manager.displayName()) == "A Manager"
+
+    def test_when_awaited_then_manager_method_called_on_worker_thread(
+        self, async_manager, mock_manager_interface, some_refs, a_context
+    ):
+        calling_threads = []
+
+        def resolve(*args):
+            calling_threads.append(threading.current_thread())
+            for idx in range(len(args[0])):
+                args[5](idx, TraitsData({"a_trait"}))
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        results = asyncio.run(
+            async_manager.resolve(
+                some_refs,
+                {"a_trait"},
+                ResolveAccess.kRead,
+                a_context,
+                Manager.BatchElementErrorPolicyTag.kVariant,
+            )
+        )
+
+        assert results == [TraitsData({"a_trait"})] * len(some_refs)
+        assert len(calling_threads) == 1
+        assert calling_threads[0] is not threading.main_thread()
+        assert calling_threads[0].name.startswith(AsyncManager.kThreadNamePrefix)
+
+    def test_when_awaited_concurrently_then_manager_methods_run_concurrently(
+        self, async_manager, mock_manager_interface, some_refs, a_context
+    ):
+        # Each call blocks until both calls are in progress, so would
+        # time out if calls were not concurrent.
+        barrier = threading.Barrier(2, timeout=5)
+
+        def resolve(*args):
+            barrier.wait()
+            for idx in range(len(args[0])):
+                args[5](idx, TraitsData())
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        async def resolve_twice():
+            return await asyncio.gather(
+                *(
+                    async_manager.resolve(
+                        some_refs,
+                        set(),
+                        ResolveAccess.kRead,
+                        a_context,
+                        Manager.BatchElementErrorPolicyTag.kVariant,
+                    )
+                    for _ in range(2)
+                )
+            )
+
+        results = asyncio.run(resolve_twice())
+
+        assert results == [[TraitsData()] * len(some_refs)] * 2
+
+    def test_when_manager_method_raises_then_exception_propagates(
+        self, async_manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.displayName.side_effect = errors.InputValidationException(
+            "Some error"
+        )
+
+        with pytest.raises(errors.InputValidationException, match="Some error"):
+            asyncio.run(async_manager.displayName())
+
+
+class Test_AsyncManager_shutdown:
+    def test_when_executor_created_then_shutdown_shuts_it_down(self, manager):
+        async_manager = AsyncManager(manager)
+        async_manager.shutdown()
+
+        with pytest.raises(RuntimeError):
+            async_manager.executor().submit(lambda: None)
+
+    def test_when_executor_given_then_shutdown_leaves_it_running(self, manager):
+        with ThreadPoolExecutor() as executor:
+            AsyncManager(manager, executor=executor).shutdown()
+
+            assert executor.submit(lambda: 123).result() == 123
+
+    def test_when_used_as_async_context_manager_then_shut_down_on_exit(
+        self, manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.displayName.return_value = "A Manager"
+
+        async def use_async_manager():
+            async with AsyncManager(manager) as async_manager:
+                return async_manager, await async_manager.displayName()
+
+        async_manager, display_name = asyncio.run(use_async_manager())
+
+        assert display_name == "A Manager"
+        with pytest.raises(RuntimeError):
+            async_manager.executor().submit(lambda: None)
+
+
+@pytest.fixture
+def async_manager(manager):
+    async_manager = AsyncManager(manager)
+    yield async_manager
+    async_manager.shutdown()
+
+
+@pytest.fixture
+def manager(mock_manager_interface, a_host_session):
+    mock_manager_interface.mock.isEntityReferenceString.return_value = True
+    return Manager(mock_manager_interface, a_host_session)
+
+
+@pytest.fixture
+def some_refs(manager):
+    return [manager.createEntityReference("asset://a"), manager.createEntityReference("asset://b")]
+
+
+@pytest.fixture
+def a_context():
+    return Context()
@@ -31,6 +31,7 @@ import pytest
 from openassetio import (
     Context,
     EntityReference,
+    EntityReferenceBatch,
     managerApi,
     constants,
     access,
@@ -2381,6 +2382,86 @@ class Test_Manager_resolve(BatchFirstMethodTest):
             expected_results=two_entity_traitsdatas,
         )
 
+    def test_when_interface_delivers_many_results_per_call_then_each_is_relayed(
+        self, four_refs, an_entity_trait_set, two_entity_traitsdatas
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+
+        def call_callbacks(*args):
+            args[5].many([2, 0], two_entity_traitsdatas)
+            args[6].many([3, 1], [self.a_batch_element_error] * 2)
+
+        self.mock_interface_method.side_effect = call_callbacks
+
+        self.method(
+            four_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            self.a_context,
+            success_callback,
+            error_callback,
+        )
+
+        assert success_callback.call_args_list == [
+            mock.call(2, two_entity_traitsdatas[0]),
+            mock.call(0, two_entity_traitsdatas[1]),
+        ]
+        assert error_callback.call_args_list == [
+            mock.call(3, self.a_batch_element_error),
+            mock.call(1, self.a_batch_element_error),
+        ]
+
+    def test_when_given_entity_reference_batch_then_interface_receives_entity_references(
+        self, two_refs, an_entity_trait_set, two_entity_traitsdatas
+    ):
+        success_callback = mock.Mock()
+
+        def call_callbacks(*args):
+            assert args[0] == two_refs
+            args[5].many([0, 1], two_entity_traitsdatas)
+
+        self.mock_interface_method.side_effect = call_callbacks
+
+        self.method(
+            EntityReferenceBatch(two_refs),
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            self.a_context,
+            success_callback,
+            mock.Mock(),
+        )
+
+        assert success_callback.call_args_list == [
+            mock.call(0, two_entity_traitsdatas[0]),
+            mock.call(1, two_entity_traitsdatas[1]),
+        ]
+
+    def test_when_interface_delivers_mismatched_many_results_then_raises(
+        self, two_refs, an_entity_trait_set, a_traitsdata
+    ):
+        success_callback = mock.Mock()
+
+        def call_callbacks(*args):
+            args[5].many([0, 1], [a_traitsdata])
+
+        self.mock_interface_method.side_effect = call_callbacks
+
+        with pytest.raises(
+            InputValidationException,
+            match=r"Number of indices \(2\) does not match number of values \(1\)",
+        ):
+            self.method(
+                two_refs,
+                an_entity_trait_set,
+                access.ResolveAccess.kRead,
+                self.a_context,
+                success_callback,
+                mock.Mock(),
+            )
+
+        success_callback.assert_not_called()
+
     def test_when_batch_overload_receives_out_of_bounds_index_then_raises(
         self, two_refs, an_entity_trait_set, a_traitsdata
     ):
@@ -2487,6 +2568,79 @@ class Test_Manager_resolve(BatchFirstMethodTest):
         )
 
 
+class Test_Manager_resolveProperties:
+    def test_wraps_resolve_of_the_held_interface(
+        self, manager, mock_manager_interface, two_refs, a_context, a_host_session
+    ):
+        method = mock_manager_interface.mock.resolve
+
+        manager.resolveProperties(
+            two_refs,
+            [("a_trait", "a_prop"), ("a_different_trait", "another_prop")],
+            access.ResolveAccess.kRead,
+            a_context,
+        )
+
+        method.assert_called_once_with(
+            two_refs,
+            {"a_trait", "a_different_trait"},
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+    def test_returns_one_list_per_property(
+        self, manager, mock_manager_interface, four_refs, a_context, a_batch_element_error
+    ):
+        first = TraitsData()
+        first.setTraitProperty("a_trait", "a_prop", "first value")
+        first.setTraitProperty("a_trait", "another_prop", 1)
+        second = TraitsData()
+        second.setTraitProperty("a_trait", "a_prop", "second value")
+
+        def call_callbacks(*args):
+            args[5](2, second)
+            args[6](1, a_batch_element_error)
+            args[5](0, first)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        columns = manager.resolveProperties(
+            four_refs,
+            [("a_trait", "a_prop"), ("a_trait", "another_prop"), ("unknown_trait", "a_prop")],
+            access.ResolveAccess.kRead,
+            a_context,
+        )
+
+        assert columns == [
+            ["first value", a_batch_element_error, "second value", None],
+            [1, a_batch_element_error, None, None],
+            [None, a_batch_element_error, None, None],
+        ]
+
+    def test_when_no_properties_requested_then_returns_empty_list(
+        self, manager, two_refs, a_context
+    ):
+        assert manager.resolveProperties(two_refs, [], access.ResolveAccess.kRead, a_context) == []
+
+    def test_when_interface_delivers_out_of_bounds_index_then_raises(
+        self, manager, mock_manager_interface, two_refs, a_context
+    ):
+        def call_callbacks(*args):
+            args[5](2, TraitsData())
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        with pytest.raises(
+            InputValidationException, match="Index '2' out of bounds for batch size of 2"
+        ):
+            manager.resolveProperties(
+                two_refs, [("a_trait", "a_prop")], access.ResolveAccess.kRead, a_context
+            )
+
+
 class Test_Manager_entityTraits(BatchFirstMethodTest):
     @pytest.fixture(autouse=True)
     def constructor(
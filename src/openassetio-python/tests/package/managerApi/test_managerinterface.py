@@ -23,6 +23,7 @@ Tests for the default implementations of ManagerInterface methods.
 import pytest
 
 from openassetio import EntityReference, Context, errors, access
+from openassetio.hostApi import Manager
 from openassetio.managerApi import (
     ManagerInterface,
     ManagerStateBase,
@@ -440,6 +441,93 @@ class Test_ManagerInterface_register:
             )
 
 
+class Test_ManagerInterface_override_dispatch:
+    """
+    Check that Python overrides called from C++ reflect changes made to
+    the Python instance or its type after the first call, i.e. that any
+    caching of overrides is invisible.
+    """
+
+    def test_when_class_method_replaced_then_new_method_called(self, a_host_session):
+        class DispatchManagerInterface(ManagerInterface):
+            def displayName(self):
+                return "original"
+
+        manager = Manager(DispatchManagerInterface(), a_host_session)
+        assert manager.displayName() == "original"
+
+        DispatchManagerInterface.displayName = lambda _self: "replaced"
+
+        assert manager.displayName() == "replaced"
+
+    def test_when_base_class_method_replaced_then_new_method_called(self, a_host_session):
+        class BaseManagerInterface(ManagerInterface):
+            def displayName(self):
+                return "original"
+
+        class DerivedManagerInterface(BaseManagerInterface):
+            pass
+
+        manager = Manager(DerivedManagerInterface(), a_host_session)
+        assert manager.displayName() == "original"
+
+        BaseManagerInterface.displayName = lambda _self: "replaced"
+
+        assert manager.displayName() == "replaced"
+
+    def test_when_instance_attribute_set_then_attribute_called(self, a_host_session):
+        class DispatchManagerInterface(ManagerInterface):
+            def displayName(self):
+                return "original"
+
+        interface = DispatchManagerInterface()
+        manager = Manager(interface, a_host_session)
+        assert manager.displayName() == "original"
+
+        interface.displayName = lambda: "instance"
+        assert manager.displayName() == "instance"
+
+        del interface.displayName
+        assert manager.displayName() == "original"
+
+    def test_when_class_reassigned_then_new_class_method_called(self, a_host_session):
+        class FirstManagerInterface(ManagerInterface):
+            def displayName(self):
+                return "first"
+
+        class SecondManagerInterface(ManagerInterface):
+            def displayName(self):
+                return "second"
+
+        interface = FirstManagerInterface()
+        manager = Manager(interface, a_host_session)
+        assert manager.displayName() == "first"
+
+        interface.__class__ = SecondManagerInterface
+
+        assert manager.displayName() == "second"
+
+    def test_when_override_calls_base_implementation_then_no_recursion(self, a_host_session):
+        class DispatchManagerInterface(ManagerInterface):
+            def __init__(self):
+                super().__init__()
+                self.numCalls = 0
+
+            def info(self):
+                self.numCalls += 1
+                info = super().info()
+                info["overridden"] = True
+                return info
+
+        interface = DispatchManagerInterface()
+        manager = Manager(interface, a_host_session)
+
+        for _ in range(3):
+            assert manager.info() == {"overridden": True}
+
+        assert interface.numCalls == 3
+
+
 @pytest.fixture
 def manager_interface():
     return ManagerInterface()
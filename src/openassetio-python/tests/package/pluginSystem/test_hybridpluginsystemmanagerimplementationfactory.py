@@ -18,6 +18,8 @@ HybridPluginSystemManagerImplementationFactory implementation.
 """
 import inspect
 import itertools
+import threading
+import time
 from unittest import mock
 
 import pytest
@@ -1538,6 +1540,104 @@ class Test_HybridPluginSystemManagerImplementationFactory_ManagerInterface:
             )
 
 
+class Test_HybridPluginSystemManagerImplementationFactory_concurrentLifecycle:
+    @pytest.mark.parametrize("method_name", ("initialize", "flushCaches"))
+    def test_when_not_concurrent_then_children_called_in_priority_order(
+        self,
+        method_name,
+        manager_interface_a,
+        manager_interface_b,
+        hybrid_manager_interface,
+        a_host_session,
+    ):
+        calls = []
+        getattr(manager_interface_a.mock, method_name).side_effect = lambda *_: calls.append("a")
+        getattr(manager_interface_b.mock, method_name).side_effect = lambda *_: calls.append("b")
+
+        args = ({}, a_host_session) if method_name == "initialize" else (a_host_session,)
+        getattr(hybrid_manager_interface, method_name)(*args)
+
+        assert calls == ["a", "b"]
+
+    @pytest.mark.parametrize("method_name", ("initialize", "flushCaches"))
+    def test_when_concurrent_then_children_called_concurrently(
+        self,
+        method_name,
+        manager_interface_a,
+        manager_interface_b,
+        concurrent_hybrid_manager_interface,
+        a_host_session,
+    ):
+        # Each child blocks until the other has been called, so this
+        # will raise BrokenBarrierError if called sequentially.
+        barrier = threading.Barrier(2, timeout=5)
+        getattr(manager_interface_a.mock, method_name).side_effect = lambda *_: barrier.wait()
+        getattr(manager_interface_b.mock, method_name).side_effect = lambda *_: barrier.wait()
+
+        args = ({}, a_host_session) if method_name == "initialize" else (a_host_session,)
+        getattr(concurrent_hybrid_manager_interface, method_name)(*args)
+
+        getattr(manager_interface_a.mock, method_name).assert_called_once_with(*args)
+        getattr(manager_interface_b.mock, method_name).assert_called_once_with(*args)
+
+    def test_when_concurrent_then_capabilities_cached_after_all_children_initialized(
+        self,
+        manager_interface_a,
+        manager_interface_b,
+        concurrent_hybrid_manager_interface,
+        a_host_session,
+    ):
+        is_b_initialized = threading.Event()
+
+        def initialize_b(*_):
+            time.sleep(0.1)
+            is_b_initialized.set()
+
+        manager_interface_a.mock.hasCapability.return_value = False
+        manager_interface_b.mock.initialize.side_effect = initialize_b
+        manager_interface_b.mock.hasCapability.side_effect = lambda _: is_b_initialized.is_set()
+
+        concurrent_hybrid_manager_interface.initialize({}, a_host_session)
+
+        for capability in ManagerInterface.Capability.__members__.values():
+            assert concurrent_hybrid_manager_interface.hasCapability(capability)
+
+    @pytest.mark.parametrize("method_name", ("initialize", "flushCaches"))
+    def test_when_concurrent_and_children_fail_then_first_child_error_raised_and_others_logged(
+        self,
+        method_name,
+        manager_interface_a,
+        manager_interface_b,
+        concurrent_hybrid_manager_interface,
+        a_host_session,
+        mock_logger,
+    ):
+        manager_interface_b.mock.displayName.return_value = "Manager B"
+
+        def fail_a(*_):
+            # Ensure child b fails first.
+            time.sleep(0.1)
+            raise errors.InputValidationException("a failed")
+
+        def fail_b(*_):
+            raise errors.InputValidationException("b failed")
+
+        getattr(manager_interface_a.mock, method_name).side_effect = fail_a
+        getattr(manager_interface_b.mock, method_name).side_effect = fail_b
+
+        args = ({}, a_host_session) if method_name == "initialize" else (a_host_session,)
+        with pytest.raises(errors.InputValidationException, match="a failed"):
+            getattr(concurrent_hybrid_manager_interface, method_name)(*args)
+
+        mock_logger.mock.log.assert_called_once()
+        severity, message = mock_logger.mock.log.call_args[0]
+        assert severity == mock_logger.Severity.kError
+        assert message.startswith(
+            f"HybridPluginSystem: {method_name} also failed for child manager 'Manager B': "
+        )
+        assert "b failed" in message
+
+
 def test_all_manager_interface_methods_tested(subtests):
     methods_to_test = (
         name
@@ -1593,6 +1693,13 @@ def hybrid_factory(factory_a, factory_b, mock_logger):
     return HybridPluginSystemManagerImplementationFactory([factory_a, factory_b], mock_logger)
 
 
+@pytest.fixture
+def concurrent_hybrid_manager_interface(factory_a, factory_b, mock_logger, the_plugin_identifier):
+    return HybridPluginSystemManagerImplementationFactory(
+        [factory_a, factory_b], mock_logger, concurrentLifecycle=True
+    ).instantiate(the_plugin_identifier)
+
+
 @pytest.fixture
 def factory_a(manager_interface_a, mock_logger, the_plugin_identifier):
     factory = MockManagerImplementationFactory(mock_logger)
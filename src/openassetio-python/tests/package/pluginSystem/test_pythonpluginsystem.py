@@ -20,7 +20,11 @@ These tests check the functionality of the PythonPluginSystem class.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import importlib.machinery
+import importlib.metadata
 import os
+import shutil
+import sys
 from typing import List
 from unittest import mock
 
@@ -515,6 +519,329 @@ class Test_PythonPluginSystem_scan_entry_points:
         )
 
 
+class Test_PythonPluginSystem_cache:
+    def test_when_module_cached_then_not_imported_until_plugin_requested(
+        self,
+        a_cached_module_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_a_identifier,
+        mock_logger,
+    ):
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_module_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_a_identifier]
+        assert not [
+            call
+            for call in mock_logger.mock.log.call_args_list
+            if call.args[1].startswith("PythonPluginSystem: Attempting to load")
+        ]
+
+        plugin = plugin_system.plugin(plugin_a_identifier)
+
+        assert plugin.identifier() == plugin_a_identifier
+        assert plugin.__file__ == os.path.join(a_cached_module_plugin_path, "modulePlugin.py")
+
+    def test_when_module_modified_then_imported_during_scan(
+        self,
+        a_cached_module_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_a_identifier,
+        mock_logger,
+    ):
+        module_path = os.path.join(a_cached_module_plugin_path, "modulePlugin.py")
+        with open(module_path, "a", encoding="utf-8") as module_file:
+            module_file.write("\n# Modified\n")
+
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_module_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_a_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            f"PythonPluginSystem: Attempting to load {module_path}",
+        )
+
+    @pytest.mark.parametrize("module_name", ["__init__.py", "PackagePlugin.py"])
+    def test_when_package_module_modified_then_imported_during_scan(
+        self,
+        module_name,
+        a_cached_package_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        package_path = os.path.join(a_cached_package_plugin_path, "packagedPlugin")
+        with open(os.path.join(package_path, module_name), "a", encoding="utf-8") as module_file:
+            module_file.write("\n# Modified\n")
+
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_package_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_b_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            "PythonPluginSystem: Attempting to load "
+            f"{os.path.join(package_path, '__init__.py')}",
+        )
+
+    def test_when_package_module_added_then_imported_during_scan(
+        self,
+        a_cached_package_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        package_path = os.path.join(a_cached_package_plugin_path, "packagedPlugin")
+        with open(os.path.join(package_path, "added.py"), "w", encoding="utf-8") as module_file:
+            module_file.write("# Added\n")
+
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_package_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_b_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            "PythonPluginSystem: Attempting to load "
+            f"{os.path.join(package_path, '__init__.py')}",
+        )
+
+    def test_when_package_extension_module_rewritten_then_imported_during_scan(
+        self,
+        a_cached_package_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        package_path = os.path.join(a_cached_package_plugin_path, "packagedPlugin")
+        extension_path = os.path.join(
+            package_path, "extension" + importlib.machinery.EXTENSION_SUFFIXES[0]
+        )
+        with open(extension_path, "wb") as extension_file:
+            extension_file.write(b"Rewritten extension module")
+
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_package_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_b_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            "PythonPluginSystem: Attempting to load "
+            f"{os.path.join(package_path, '__init__.py')}",
+        )
+
+    def test_when_package_cached_then_not_imported_during_scan(
+        self,
+        a_cached_package_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        plugin_system = PythonPluginSystem(mock_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_package_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_b_identifier]
+        assert not [
+            call
+            for call in mock_logger.mock.log.call_args_list
+            if call.args[1].startswith("PythonPluginSystem: Attempting to load")
+        ]
+
+    def test_when_cached_module_no_longer_provides_identifier_then_plugin_raises(
+        self,
+        a_cached_module_plugin_path,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        plugin_a_identifier,
+        a_logger,
+    ):
+        # Change the identifier whilst keeping the file's size and
+        # modification time, such that the cache entry looks valid.
+        module_path = os.path.join(a_cached_module_plugin_path, "modulePlugin.py")
+        stat = os.stat(module_path)
+        with open(module_path, "r", encoding="utf-8") as module_file:
+            contents = module_file.read()
+        with open(module_path, "w", encoding="utf-8") as module_file:
+            module_file.write(
+                contents.replace(plugin_a_identifier, plugin_a_identifier[:-1] + "Z")
+            )
+        os.utime(module_path, ns=(stat.st_atime_ns, stat.st_mtime_ns))
+
+        plugin_system = PythonPluginSystem(a_logger, a_cache_path)
+        plugin_system.scan_paths(a_cached_module_plugin_path, the_manager_plugin_module_hook)
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match=f"PythonPluginSystem: Cached plug-in '{plugin_a_identifier}' could not be"
+            f" loaded from '{module_path}'. The discovery cache may be stale.",
+        ):
+            plugin_system.plugin(plugin_a_identifier)
+
+        assert plugin_system.identifiers() == []
+
+    def test_when_entry_points_cached_then_distributions_not_queried(
+        self,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        an_entry_point_package_plugin_root,
+        entry_point_plugin_identifier,
+        a_logger,
+        monkeypatch,
+    ):
+        monkeypatch.syspath_prepend(an_entry_point_package_plugin_root)
+        PythonPluginSystem(a_logger, a_cache_path).scan_entry_points(
+            PLUGIN_ENTRY_POINT_GROUP, the_manager_plugin_module_hook
+        )
+
+        mock_entry_points = mock.Mock(wraps=importlib.metadata.entry_points)
+        monkeypatch.setattr(importlib.metadata, "entry_points", mock_entry_points)
+
+        plugin_system = PythonPluginSystem(a_logger, a_cache_path)
+        plugin_system.scan_entry_points(PLUGIN_ENTRY_POINT_GROUP, the_manager_plugin_module_hook)
+
+        mock_entry_points.assert_not_called()
+        assert plugin_system.identifiers() == [entry_point_plugin_identifier]
+        assert (
+            plugin_system.plugin(entry_point_plugin_identifier).identifier()
+            == entry_point_plugin_identifier
+        )
+
+    def test_when_editable_entry_point_modified_without_version_change_then_imported_during_scan(
+        self,
+        a_cache_path,
+        the_manager_plugin_module_hook,
+        an_editable_entry_point_plugin_source_path,
+        entry_point_plugin_identifier,
+        a_logger,
+    ):
+        PythonPluginSystem(a_logger, a_cache_path).scan_entry_points(
+            PLUGIN_ENTRY_POINT_GROUP, the_manager_plugin_module_hook
+        )
+        forget_packaged_plugin_modules()
+
+        module_path = os.path.join(
+            an_editable_entry_point_plugin_source_path, "packaged_plugin", "PackagePlugin.py"
+        )
+        modified_identifier = entry_point_plugin_identifier + "Modified"
+        with open(module_path, "r", encoding="utf-8") as module_file:
+            contents = module_file.read()
+        with open(module_path, "w", encoding="utf-8") as module_file:
+            module_file.write(contents.replace(entry_point_plugin_identifier, modified_identifier))
+
+        plugin_system = PythonPluginSystem(a_logger, a_cache_path)
+        plugin_system.scan_entry_points(PLUGIN_ENTRY_POINT_GROUP, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [modified_identifier]
+
+    def test_when_cache_unreadable_then_warning_logged_and_plugins_loaded(
+        self,
+        a_python_module_plugin_path,
+        the_manager_plugin_module_hook,
+        plugin_a_identifier,
+        mock_logger,
+        tmp_path,
+    ):
+        cache_path = os.path.join(tmp_path, "cache.json")
+        with open(cache_path, "w", encoding="utf-8") as cache_file:
+            cache_file.write("{not json")
+
+        plugin_system = PythonPluginSystem(mock_logger, cache_path)
+        plugin_system.scan_paths(a_python_module_plugin_path, the_manager_plugin_module_hook)
+
+        assert plugin_system.identifiers() == [plugin_a_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            StringContaining(
+                [f"PythonPluginSystem: Ignoring unreadable plugin cache {cache_path}"]
+            ),
+        )
+
+    @pytest.fixture
+    def a_cache_path(self, tmp_path):
+        return os.path.join(tmp_path, "cache.json")
+
+    @pytest.fixture
+    def a_cached_module_plugin_path(
+        self, a_python_module_plugin_path, a_cache_path, the_manager_plugin_module_hook, tmp_path
+    ):
+        """
+        A copy of the module plugin path, that has been scanned once to
+        populate the cache at `a_cache_path`.
+        """
+        plugin_path = os.path.join(tmp_path, "plugins")
+        shutil.copytree(a_python_module_plugin_path, plugin_path)
+        PythonPluginSystem(ConsoleLogger(), a_cache_path).scan_paths(
+            plugin_path, the_manager_plugin_module_hook
+        )
+        return plugin_path
+
+    @pytest.fixture
+    def a_cached_package_plugin_path(
+        self, a_python_package_plugin_path, a_cache_path, the_manager_plugin_module_hook, tmp_path
+    ):
+        """
+        A copy of the package plugin path, that has been scanned once to
+        populate the cache at `a_cache_path`.
+        """
+        plugin_path = os.path.join(tmp_path, "plugins")
+        shutil.copytree(
+            a_python_package_plugin_path,
+            plugin_path,
+            ignore=shutil.ignore_patterns("__pycache__"),
+        )
+        # Never imported, but, as with any module file in the package,
+        # changes to it must invalidate the cache.
+        extension_path = os.path.join(
+            plugin_path, "packagedPlugin", "extension" + importlib.machinery.EXTENSION_SUFFIXES[0]
+        )
+        with open(extension_path, "wb") as extension_file:
+            extension_file.write(b"Extension module")
+        PythonPluginSystem(ConsoleLogger(), a_cache_path).scan_paths(
+            plugin_path, the_manager_plugin_module_hook
+        )
+        return plugin_path
+
+    @pytest.fixture
+    def an_editable_entry_point_plugin_source_path(
+        self, the_python_resources_directory_path, tmp_path, monkeypatch
+    ):
+        """
+        A copy of the entry point plugin's distribution, installed as
+        if in editable mode, i.e. with its metadata and its source in
+        separate `sys.path` directories.
+
+        @return The source directory.
+        """
+        resources_path = os.path.join(the_python_resources_directory_path, "entryPoint")
+        site_packages_path = os.path.join(tmp_path, "site-packages")
+        shutil.copytree(
+            os.path.join(resources_path, "site-packages", "packaged_plugin-0.0.0.dist-info"),
+            os.path.join(site_packages_path, "packaged_plugin-0.0.0.dist-info"),
+        )
+        source_path = os.path.join(tmp_path, "src")
+        shutil.copytree(
+            os.path.join(resources_path, "src"),
+            source_path,
+            ignore=shutil.ignore_patterns("__pycache__"),
+        )
+        monkeypatch.syspath_prepend(site_packages_path)
+        monkeypatch.syspath_prepend(source_path)
+
+        # Ensure the copy is imported, rather than any previously
+        # imported module, and that the copy doesn't leak into other
+        # tests.
+        for name in packaged_plugin_module_names():
+            monkeypatch.delitem(sys.modules, name)
+        yield source_path
+        forget_packaged_plugin_modules()
+
+
 class Test_PythonPluginSystem_plugin:
     def test_when_plugin_not_found_then_raises_InputValidationException(self, a_plugin_system):
         with pytest.raises(
@@ -571,6 +898,23 @@ def a_module_hook_name():
     return "some_hook"
 
 
+def packaged_plugin_module_names():
+    return [
+        name
+        for name in sys.modules
+        if name == "packaged_plugin" or name.startswith("packaged_plugin.")
+    ]
+
+
+def forget_packaged_plugin_modules():
+    """
+    Removes the entry point plugin's modules from `sys.modules`, such
+    that they are re-imported from source when next loaded.
+    """
+    for name in packaged_plugin_module_names():
+        del sys.modules[name]
+
+
 class StringContaining:
     """
     A helper class that aids testing runtime generated strings that may
@@ -47,6 +47,12 @@ class Test_PythonPluginSystemManagerImplementationFactory:
             == "OPENASSETIO_DISABLE_ENTRYPOINTS_PLUGINS"
         )
 
+    def test_exposes_plugin_cache_var_name_with_expected_value(self):
+        assert (
+            PythonPluginSystemManagerImplementationFactory.kPluginCacheEnvVar
+            == "OPENASSETIO_PYTHON_PLUGIN_CACHE"
+        )
+
     def test_exposes_entry_point_group_with_expected_value(self):
         assert (
             PythonPluginSystemManagerImplementationFactory.kPackageEntryPointGroup
@@ -110,6 +116,44 @@ class Test_PythonPluginSystemManagerImplementationFactory_init:
             PythonPluginSystemManagerImplementationFactory.kModuleHookName,
         )
 
+    def test_when_no_cache_path_then_plugin_system_not_given_cache(
+        self, mock_plugin_system_class, monkeypatch
+    ):
+        monkeypatch.delenv(
+            PythonPluginSystemManagerImplementationFactory.kPluginCacheEnvVar, raising=False
+        )
+        factory = PythonPluginSystemManagerImplementationFactory(ConsoleLogger())
+
+        factory.identifiers()
+
+        mock_plugin_system_class.assert_called_once_with(mock.ANY, None)
+
+    def test_when_cache_path_env_var_set_then_plugin_system_given_cache(
+        self, mock_plugin_system_class, monkeypatch
+    ):
+        monkeypatch.setenv(
+            PythonPluginSystemManagerImplementationFactory.kPluginCacheEnvVar, "/some/cache"
+        )
+        factory = PythonPluginSystemManagerImplementationFactory(ConsoleLogger())
+
+        factory.identifiers()
+
+        mock_plugin_system_class.assert_called_once_with(mock.ANY, "/some/cache")
+
+    def test_when_cache_path_arg_then_env_var_not_used(
+        self, mock_plugin_system_class, monkeypatch
+    ):
+        monkeypatch.setenv(
+            PythonPluginSystemManagerImplementationFactory.kPluginCacheEnvVar, "/some/cache"
+        )
+        factory = PythonPluginSystemManagerImplementationFactory(
+            ConsoleLogger(), cachePath="/other/cache"
+        )
+
+        factory.identifiers()
+
+        mock_plugin_system_class.assert_called_once_with(mock.ANY, "/other/cache")
+
 
 class Test_PythonPluginSystemManagerImplementationFactory_identifiers:
     def test_lazy_scans_for_plugins_before_returning_identifiers(
@@ -167,3 +211,10 @@ def mock_plugin_system(monkeypatch):
         plugin_system,
     )
     return plugin_system.return_value
+
+
+@pytest.fixture
+def mock_plugin_system_class(mock_plugin_system):  # pylint: disable=unused-argument
+    return sys.modules[
+        PythonPluginSystemManagerImplementationFactory.__module__
+    ].PythonPluginSystem
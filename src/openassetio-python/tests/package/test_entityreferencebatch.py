@@ -0,0 +1,119 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the EntityReferenceBatch type.
+"""
+
+# pylint: disable=too-few-public-methods
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+
+import pytest
+
+from openassetio import EntityReference, EntityReferenceBatch
+
+
+class Test_EntityReferenceBatch_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(EntityReferenceBatch):
+                pass
+
+
+class Test_EntityReferenceBatch_init:
+    def test_when_constructed_from_list_then_contains_entity_references(self, some_refs):
+        batch = EntityReferenceBatch(some_refs)
+
+        assert list(batch) == some_refs
+
+    def test_when_constructed_from_batch_then_contains_entity_references(self, some_refs):
+        batch = EntityReferenceBatch(EntityReferenceBatch(some_refs))
+
+        assert list(batch) == some_refs
+
+    def test_when_constructed_from_non_entity_references_then_raises(self):
+        with pytest.raises(TypeError):
+            EntityReferenceBatch(["ref://a"])
+
+
+class Test_EntityReferenceBatch_fromStrings:
+    def test_when_constructed_from_strings_then_contains_entity_references(self, some_refs):
+        batch = EntityReferenceBatch.fromStrings([ref.toString() for ref in some_refs])
+
+        assert list(batch) == some_refs
+
+
+class Test_EntityReferenceBatch_toStrings:
+    def test_returns_entity_reference_strings(self, some_refs):
+        batch = EntityReferenceBatch(some_refs)
+
+        assert batch.toStrings() == [ref.toString() for ref in some_refs]
+
+
+class Test_EntityReferenceBatch_sequence:
+    def test_len_is_number_of_entity_references(self, some_refs):
+        assert len(EntityReferenceBatch(some_refs)) == len(some_refs)
+        assert len(EntityReferenceBatch([])) == 0
+
+    def test_getitem_returns_entity_reference_at_index(self, some_refs):
+        batch = EntityReferenceBatch(some_refs)
+
+        assert batch[0] == some_refs[0]
+        assert batch[2] == some_refs[2]
+        assert batch[-1] == some_refs[-1]
+        assert batch[-3] == some_refs[0]
+
+    def test_when_index_out_of_range_then_IndexError_raised(self, some_refs):
+        batch = EntityReferenceBatch(some_refs)
+
+        with pytest.raises(IndexError):
+            _ = batch[3]
+
+        with pytest.raises(IndexError):
+            _ = batch[-4]
+
+    def test_iteration_outlives_batch(self, some_refs):
+        iterator = iter(EntityReferenceBatch(some_refs))
+
+        assert list(iterator) == some_refs
+
+
+class Test_EntityReferenceBatch_equality:
+    def test_batches_with_same_entity_references_are_equal(self, some_refs):
+        assert EntityReferenceBatch(some_refs) == EntityReferenceBatch(list(some_refs))
+
+    def test_batches_with_different_entity_references_are_not_equal(self, some_refs):
+        assert EntityReferenceBatch(some_refs) != EntityReferenceBatch(some_refs[:2])
+
+    def test_batch_is_not_equal_to_list(self, some_refs):
+        assert EntityReferenceBatch(some_refs) != some_refs
+
+
+class Test_EntityReferenceBatch_repr:
+    def test_repr_contains_size(self, some_refs):
+        assert repr(EntityReferenceBatch(some_refs)) == (
+            "EntityReferenceBatch(<3 entity references>)"
+        )
+
+
+@pytest.fixture
+def some_refs():
+    return [
+        EntityReference("ref://a"),
+        EntityReference("ref://b"),
+        EntityReference("ref://🐈"),
+    ]
@@ -55,6 +55,9 @@ class Test_package_imports:
     def test_importing_EntityReference_succeeds(self):
         from openassetio import EntityReference
 
+    def test_importing_EntityReferenceBatch_succeeds(self):
+        from openassetio import EntityReferenceBatch
+
     def test_importing_log_succeeds(self):
         from openassetio import log
 
@@ -63,6 +66,9 @@ class Test_package_imports:
 
 
 class Test_hostApi_imports:
+    def test_importing_AsyncManager_succeeds(self):
+        from openassetio.hostApi import AsyncManager
+
     def test_importing_HostInterface_succeeds(self):
         from openassetio.hostApi import HostInterface
 
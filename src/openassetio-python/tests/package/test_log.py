@@ -20,8 +20,11 @@ Tests that cover the openassetio.log module.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import datetime
+
 import pytest
 
+from openassetio import errors
 import openassetio.log as lg
 
 
@@ -324,3 +327,144 @@ class Test_SeverityFilter_upstreamLogger:
     def test_returns_the_constructor_supplied_logger(self, mock_logger):
         a_filter = lg.SeverityFilter(mock_logger)
         assert a_filter.upstreamLogger() is mock_logger
+
+
+class Test_SeverityFilter_sourceLogger:
+    def test_when_called_repeatedly_with_same_source_then_same_logger_returned(
+        self, severity_filter
+    ):
+        assert severity_filter.sourceLogger("a") is severity_filter.sourceLogger("a")
+        assert severity_filter.sourceLogger("a") is not severity_filter.sourceLogger("b")
+
+    def test_when_no_source_severity_set_then_filter_severity_used(self, severity_filter):
+        mock_logger = severity_filter.upstreamLogger()
+        source_logger = severity_filter.sourceLogger("a")
+
+        for filter_severity in all_severities:
+            severity_filter.setSeverity(filter_severity)
+
+            for message_severity in all_severities:
+                mock_logger.mock.reset_mock()
+                source_logger.log(message_severity, "A message")
+                if message_severity >= filter_severity:
+                    mock_logger.mock.log.assert_called_once_with(message_severity, "A message")
+                else:
+                    mock_logger.mock.log.assert_not_called()
+
+    @pytest.mark.parametrize("is_severity_logged", (True, False))
+    @pytest.mark.parametrize("source_severity", all_severities)
+    @pytest.mark.parametrize("log_severity", all_severities)
+    def test_when_source_severity_set_then_source_severity_used(
+        self, mock_logger, severity_filter, is_severity_logged, source_severity, log_severity
+    ):
+        mock_logger.mock.isSeverityLogged.return_value = is_severity_logged
+        source_logger = severity_filter.sourceLogger("a")
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kCritical)
+        severity_filter.setSourceSeverity("a", source_severity)
+
+        expected = log_severity >= source_severity and is_severity_logged
+        assert source_logger.isSeverityLogged(log_severity) == expected
+        source_logger.log(log_severity, "a message")
+        assert mock_logger.mock.log.called == expected
+
+    def test_when_source_severity_set_then_other_sources_unaffected(self, severity_filter):
+        severity_filter.setSourceSeverity("a", lg.LoggerInterface.Severity.kDebugApi)
+
+        assert not severity_filter.isSeverityLogged(lg.LoggerInterface.Severity.kDebugApi)
+        assert not severity_filter.sourceLogger("b").isSeverityLogged(
+            lg.LoggerInterface.Severity.kDebugApi
+        )
+        assert severity_filter.sourceLogger("a").isSeverityLogged(
+            lg.LoggerInterface.Severity.kDebugApi
+        )
+
+
+class Test_SeverityFilter_setSourceSeverity_getSourceSeverity:
+    def test_when_source_severity_not_set_then_get_returns_None(self, severity_filter):
+        assert severity_filter.getSourceSeverity("a") is None
+
+    def test_when_source_severity_set_then_get_returns_the_new_value(self, severity_filter):
+        for severity in all_severities:
+            severity_filter.setSourceSeverity("a", severity)
+            assert severity_filter.getSourceSeverity("a") == severity
+        assert severity_filter.getSourceSeverity("b") is None
+
+
+class Test_SeverityFilter_resetSourceSeverity:
+    def test_when_source_severity_reset_then_filter_severity_used(self, severity_filter):
+        source_logger = severity_filter.sourceLogger("a")
+        severity_filter.setSourceSeverity("a", lg.LoggerInterface.Severity.kDebugApi)
+
+        severity_filter.resetSourceSeverity("a")
+
+        assert severity_filter.getSourceSeverity("a") is None
+        assert not source_logger.isSeverityLogged(lg.LoggerInterface.Severity.kDebugApi)
+        assert source_logger.isSeverityLogged(lg.LoggerInterface.Severity.kWarning)
+
+    def test_when_unknown_source_reset_then_no_error(self, severity_filter):
+        severity_filter.resetSourceSeverity("unknown")
+        assert severity_filter.getSourceSeverity("unknown") is None
+
+
+class Test_DuplicateFilter_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(lg.DuplicateFilter):
+                pass
+
+
+class Test_DuplicateFilter_init:
+    def test_when_logger_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError) as err:
+            lg.DuplicateFilter(None)
+
+        assert str(err.value).startswith("__init__(): incompatible constructor arguments")
+
+    def test_when_window_not_provided_then_default_used(self, mock_logger):
+        a_filter = lg.DuplicateFilter(mock_logger)
+        assert a_filter.window() == datetime.timedelta(seconds=1)
+
+    def test_when_window_provided_then_used(self, mock_logger):
+        a_filter = lg.DuplicateFilter(mock_logger, datetime.timedelta(seconds=5))
+        assert a_filter.window() == datetime.timedelta(seconds=5)
+
+    def test_when_window_is_zero_then_raises_InputValidationException(self, mock_logger):
+        with pytest.raises(errors.InputValidationException) as err:
+            lg.DuplicateFilter(mock_logger, datetime.timedelta(0))
+
+        assert str(err.value) == "DuplicateFilter: Window must be greater than zero"
+
+
+class Test_DuplicateFilter_upstreamLogger:
+    def test_returns_the_constructor_supplied_logger(self, mock_logger):
+        a_filter = lg.DuplicateFilter(mock_logger)
+        assert a_filter.upstreamLogger() is mock_logger
+
+
+class Test_DuplicateFilter_log:
+    def test_when_message_repeated_then_summary_relayed_on_flush(self, mock_logger):
+        mock_logger.mock.isSeverityLogged.return_value = True
+        a_filter = lg.DuplicateFilter(mock_logger, datetime.timedelta(hours=1))
+
+        for _ in range(3):
+            a_filter.log(lg.LoggerInterface.Severity.kWarning, "a message")
+
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kWarning, "a message"
+        )
+
+        mock_logger.mock.reset_mock()
+        a_filter.flush()
+
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kWarning, "a message (repeated 2 more times)"
+        )
+
+    def test_when_upstream_does_not_log_severity_then_message_not_relayed(self, mock_logger):
+        mock_logger.mock.isSeverityLogged.return_value = False
+        a_filter = lg.DuplicateFilter(mock_logger)
+
+        a_filter.log(lg.LoggerInterface.Severity.kWarning, "a message")
+
+        mock_logger.mock.log.assert_not_called()
@@ -183,6 +183,88 @@ class Test_TraitsData_equality:
         assert data_a != data_b
 
 
+class Test_TraitsData_toDict:
+    def test_when_empty_then_returns_empty_dict(self):
+        assert TraitsData().toDict() == {}
+
+    def test_returns_all_traits_and_properties(self, a_populated_traitsdata, a_traits_dict):
+        assert a_populated_traitsdata.toDict() == a_traits_dict
+
+    def test_property_value_types_are_preserved(self, a_populated_traitsdata):
+        properties = a_populated_traitsdata.toDict()["first_trait"]
+
+        assert isinstance(properties["a string"], str)
+        assert isinstance(properties["an int"], int)
+        assert isinstance(properties["a float"], float)
+        assert properties["a bool"] is True
+
+
+class Test_TraitsData_fromDict:
+    def test_when_empty_then_returns_empty_traitsdata(self):
+        assert TraitsData.fromDict({}) == TraitsData()
+
+    def test_returns_traitsdata_with_all_traits_and_properties(
+        self, a_populated_traitsdata, a_traits_dict
+    ):
+        assert TraitsData.fromDict(a_traits_dict) == a_populated_traitsdata
+
+    def test_round_trip_is_lossless(self, a_populated_traitsdata):
+        assert TraitsData.fromDict(a_populated_traitsdata.toDict()) == a_populated_traitsdata
+
+    def test_when_value_is_not_supported_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            TraitsData.fromDict({"a_trait": {"unknown type": object()}})
+
+        with pytest.raises(TypeError):
+            TraitsData.fromDict({"a_trait": {"unknown type": None}})
+
+
+class Test_TraitsData_toDicts:
+    def test_returns_dict_per_traitsdata(self, a_populated_traitsdata, a_traits_dict):
+        assert TraitsData.toDicts([a_populated_traitsdata, TraitsData({"a_trait"})]) == [
+            a_traits_dict,
+            {"a_trait": {}},
+        ]
+
+    def test_when_empty_then_returns_empty_list(self):
+        assert TraitsData.toDicts([]) == []
+
+    def test_when_element_is_None_then_raises_TypeError(self, a_populated_traitsdata):
+        with pytest.raises(TypeError, match="TraitsData.toDicts: TraitsData cannot be None"):
+            TraitsData.toDicts([a_populated_traitsdata, None])
+
+
+class Test_TraitsData_fromDicts:
+    def test_returns_traitsdata_per_dict(self, a_populated_traitsdata, a_traits_dict):
+        assert TraitsData.fromDicts([a_traits_dict, {"a_trait": {}}]) == [
+            a_populated_traitsdata,
+            TraitsData({"a_trait"}),
+        ]
+
+    def test_when_empty_then_returns_empty_list(self):
+        assert TraitsData.fromDicts([]) == []
+
+
+@pytest.fixture
+def a_traits_dict():
+    return {
+        "first_trait": {"a string": "string", "an int": 1, "a float": 1.0, "a bool": True},
+        "second_trait": {},
+        "🦆": {"🐈": "🐕"},
+    }
+
+
+@pytest.fixture
+def a_populated_traitsdata():
+    traits_data = TraitsData({"second_trait"})
+    traits_data.setTraitProperty("first_trait", "a string", "string")
+    traits_data.setTraitProperty("first_trait", "an int", 1)
+    traits_data.setTraitProperty("first_trait", "a float", 1.0)
+    traits_data.setTraitProperty("first_trait", "a bool", True)
+    traits_data.setTraitProperty("🦆", "🐈", "🐕")
+    return traits_data
+
+
 @pytest.fixture
 def a_traitsdata():
     return TraitsData({"first_trait", "second_trait"})
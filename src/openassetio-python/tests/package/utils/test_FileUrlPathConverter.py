@@ -166,6 +166,96 @@ class Test_pathFromUrl:
             raise RuntimeError("Unhandled URL mapping")
 
 
+class Test_pathToUrl_batch:
+    @pytest.mark.parametrize(
+        "path_type,url_key", [(PathType.kPOSIX, "URL_posix"), (PathType.kWindows, "URL_windows")]
+    )
+    def test_when_all_valid_then_urls_match_single_conversion(
+        self, file_path_to_url_json, url_path_converter, path_type, url_key
+    ):
+        cases = [case for case in file_path_to_url_json if isinstance(case[url_key], str)]
+        paths = [case["file_path"] for case in cases]
+
+        actual = url_path_converter.pathToUrl(paths, path_type)
+
+        assert actual == [case[url_key] for case in cases]
+
+    def test_when_empty_then_empty_list_returned(self, url_path_converter):
+        assert url_path_converter.pathToUrl([], PathType.kPOSIX) == []
+
+    def test_when_any_invalid_then_raises(self, url_path_converter):
+        paths = ["/valid/path", "relative/path", "/another/valid/path"]
+
+        with pytest.raises(
+            InputValidationException,
+            match=re.escape(error_messages["relative-path"].format("relative/path")),
+        ):
+            url_path_converter.pathToUrl(paths, PathType.kPOSIX)
+
+
+class Test_pathFromUrl_batch:
+    @pytest.mark.parametrize(
+        "path_type,path_key",
+        [(PathType.kPOSIX, "file_path_posix"), (PathType.kWindows, "file_path_windows")],
+    )
+    def test_when_all_valid_then_paths_match_single_conversion(
+        self, url_to_file_path_json, url_path_converter, path_type, path_key
+    ):
+        cases = [case for case in url_to_file_path_json if isinstance(case[path_key], str)]
+        urls = [case["URL"] for case in cases]
+
+        actual = url_path_converter.pathFromUrl(urls, path_type)
+
+        assert actual == [case[path_key] for case in cases]
+
+    def test_when_any_invalid_then_raises(self, url_path_converter):
+        urls = ["file:///valid/path", "http://not/a/file/url"]
+
+        with pytest.raises(
+            InputValidationException,
+            match=re.escape(error_messages["not-a-file-url"].format("http://not/a/file/url")),
+        ):
+            url_path_converter.pathFromUrl(urls, PathType.kPOSIX)
+
+
+class Test_cacheStatistics:
+    def test_when_not_cached_then_statistics_are_zero(self):
+        converter = utils.FileUrlPathConverter()
+        converter.pathToUrl("/a", PathType.kPOSIX)
+
+        statistics = converter.cacheStatistics()
+
+        assert statistics.hits == 0
+        assert statistics.misses == 0
+        assert statistics.size == 0
+        assert statistics.capacity == 0
+
+    def test_when_converted_repeatedly_then_subsequent_conversions_are_hits(self):
+        converter = utils.FileUrlPathConverter(cacheCapacity=10)
+
+        for _ in range(3):
+            assert converter.pathToUrl("/a b", PathType.kPOSIX) == "file:///a%20b"
+            assert converter.pathFromUrl("file:///a%20b", PathType.kPOSIX) == "/a b"
+
+        statistics = converter.cacheStatistics()
+        assert statistics.hits == 4
+        assert statistics.misses == 2
+        assert statistics.size == 2
+        assert statistics.capacity == 10
+
+    def test_when_invalid_then_error_not_cached(self):
+        converter = utils.FileUrlPathConverter(cacheCapacity=10)
+
+        for _ in range(2):
+            with pytest.raises(InputValidationException):
+                converter.pathToUrl("/a/../b", PathType.kPOSIX)
+
+        statistics = converter.cacheStatistics()
+        assert statistics.hits == 0
+        assert statistics.misses == 2
+        assert statistics.size == 0
+
+
 def exc_to_regex(exc):
     return re.escape(str(exc))
 
@@ -179,9 +269,12 @@ def str_or_error(maybe_error, path_or_url):
 
 
 # "module" scope to ensure we test re-using long-lived instance.
-@pytest.fixture(scope="module")
-def url_path_converter():
-    return utils.FileUrlPathConverter()
+# Parametrised to also test results are unaffected by caching.
+@pytest.fixture(scope="module", params=[None, 1000], ids=["uncached", "cached"])
+def url_path_converter(request):
+    if request.param is None:
+        return utils.FileUrlPathConverter()
+    return utils.FileUrlPathConverter(cacheCapacity=request.param)
 
 
 @pytest.fixture
@@ -71,3 +71,72 @@ class Test_substitute:
         assert utils.substitute("hello {name:04d}", {"name": 1}) == "hello 0001"
         assert utils.substitute("hello {name:04d}", {"name": 123}) == "hello 0123"
         assert utils.substitute("hello {name:04d}", {"name": 12345}) == "hello 12345"
+
+
+class Test_CompiledSubstitution:
+    @pytest.mark.parametrize(
+        "template",
+        [
+            "hello",
+            "",
+            "hello {name}",
+            "{name}/{version:03d}/{name}.{frame:04d}.exr",
+            "{{escaped}} {name} }}",
+            "{ratio} {flag}",
+        ],
+    )
+    def test_when_rendered_then_matches_substitute(self, template):
+        substitutions = {"name": "world", "version": 7, "frame": 1001, "ratio": 1.5, "flag": True}
+
+        compiled = utils.CompiledSubstitution(template)
+
+        assert compiled.render(substitutions) == utils.substitute(template, substitutions)
+
+    def test_when_constructed_then_input_and_keys_available(self):
+        compiled = utils.CompiledSubstitution("{b}/{a:02d}/{b}")
+
+        assert compiled.input() == "{b}/{a:02d}/{b}"
+        assert compiled.keys() == ["b", "a"]
+
+    def test_when_rendered_with_batch_then_returns_list_of_strings(self):
+        compiled = utils.CompiledSubstitution("{name}.{frame:04d}.exr")
+
+        actual = compiled.render([{"name": "sh0100", "frame": frame} for frame in range(1, 4)])
+
+        assert actual == ["sh0100.0001.exr", "sh0100.0002.exr", "sh0100.0003.exr"]
+
+    def test_when_missing_substitution_variable_then_raises_InputValidationException(self):
+        expected_error = re.escape(
+            "substitute(): failed to process the input string 'hello {name}': argument not found"
+        )
+        compiled = utils.CompiledSubstitution("hello {name}")
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            compiled.render({})
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            compiled.render([{"name": "world"}, {}])
+
+    def test_when_incompatible_format_specifier_then_raises_InputValidationException(self):
+        compiled = utils.CompiledSubstitution("hello {name:04d}")
+
+        with pytest.raises(errors.InputValidationException, match="invalid type specifier"):
+            compiled.render({"name": "world"})
+
+    @pytest.mark.parametrize(
+        "template,reason",
+        [
+            ("hello {", "invalid format string"),
+            ("hello }", "unmatched '}' in format string"),
+            ("hello {}", "positional placeholders are not supported"),
+            ("hello {0}", "positional placeholders are not supported"),
+            ("hello {name:{width}}", "nested placeholders are not supported"),
+        ],
+    )
+    def test_when_template_malformed_then_raises_InputValidationException(self, template, reason):
+        expected_error = re.escape(
+            f"substitute(): failed to process the input string '{template}': {reason}"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledSubstitution(template)